@@ -9,11 +9,51 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 namespace Azure { namespace Core {
 
+  /**
+   * @brief Gets the length of the base 64 text that binary data of the given length encodes to.
+   *
+   * @param length The length of the binary data.
+   * @return The length of the encoded text, including padding.
+   */
+  constexpr std::size_t Base64EncodedLength(std::size_t length) { return (length + 2) / 3 * 4; }
+
+  /**
+   * @brief Gets the maximum length of the binary data that base 64 text of the given length
+   * decodes to.
+   *
+   * @param length The length of the encoded text.
+   * @return An upper bound of the length of the decoded data.
+   */
+  constexpr std::size_t Base64DecodedMaxLength(std::size_t length) { return (length + 3) / 4 * 3; }
+
+  /**
+   * @brief Encodes binary data into UTF-8 encoded text represented as base 64, written into a
+   * caller provided buffer.
+   *
+   * @param data The binary data that needs to be encoded.
+   * @param length The length of the binary data.
+   * @param output The buffer that receives the encoded text, at least Base64EncodedLength(length)
+   * characters long. No null terminator is written.
+   * @return The number of characters written.
+   */
+  std::size_t Base64Encode(const uint8_t* data, std::size_t length, char* output);
+
+  /**
+   * @brief Encodes binary data into UTF-8 encoded text represented as base 64.
+   *
+   * @param data The binary data that needs to be encoded.
+   * @param length The length of the binary data.
+   * @return The UTF-8 encoded text in base 64.
+   */
+  std::string Base64Encode(const uint8_t* data, std::size_t length);
+
   /**
    * @brief Encodes the vector of binary data into UTF-8 encoded text represented as base 64.
    *
@@ -22,11 +62,26 @@ namespace Azure { namespace Core {
    */
   std::string Base64Encode(const std::vector<uint8_t>& data);
 
+  /**
+   * @brief Decodes the UTF-8 encoded text represented as base 64 into binary data written into a
+   * caller provided buffer.
+   *
+   * @param text The UTF-8 encoded text in base 64 that needs to be decoded. The padding at the end
+   * is optional.
+   * @param length The length of the text.
+   * @param output The buffer that receives the decoded data, at least
+   * Base64DecodedMaxLength(length) bytes long.
+   * @return The number of bytes written.
+   * @throw std::invalid_argument if the text isn't valid base 64.
+   */
+  std::size_t Base64Decode(const char* text, std::size_t length, uint8_t* output);
+
   /**
    * @brief Decodes the UTF-8 encoded text represented as base 64 into binary data.
    *
    * @param text The input UTF-8 encoded text in base 64 that needs to be decoded.
    * @return The decoded binary data.
+   * @throw std::invalid_argument if the text isn't valid base 64.
    */
   std::vector<uint8_t> Base64Decode(const std::string& text);
 
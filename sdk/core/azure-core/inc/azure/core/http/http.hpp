@@ -20,7 +20,6 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 #if defined(TESTING_BUILD)
@@ -252,9 +251,10 @@ namespace Azure { namespace Core { namespace Http {
     // query parameters are all encoded
     std::map<std::string, std::string> m_encodedQueryParameters;
 
-    // List of default non-URL-encode chars. While URL encoding a string, do not escape any chars in
-    // this set.
-    const static std::unordered_set<unsigned char> defaultNonUrlEncodeChars;
+    // Appends the path and query parameters to url, without a leading '/'.
+    void AppendRelativeUrl(std::string& url) const;
+    // Number of characters AppendRelativeUrl() appends.
+    std::size_t GetRelativeUrlLength() const;
 
   public:
     /**
@@ -409,13 +409,13 @@ namespace Azure { namespace Core { namespace Http {
     uint16_t GetPort() const { return m_port; }
 
     /**
-     * @brief Provides a copy to the list of query parameters from the URL.
+     * @brief Provides the list of query parameters from the URL.
      *
      * @remark The query parameters are URL-encoded.
      *
      * @return const std::map<std::string, std::string>&
      */
-    std::map<std::string, std::string> GetQueryParameters() const
+    const std::map<std::string, std::string>& GetQueryParameters() const
     {
       return m_encodedQueryParameters;
     }
@@ -554,6 +554,37 @@ namespace Azure { namespace Core { namespace Http {
      */
     std::map<std::string, std::string> GetHeaders() const;
 
+    /**
+     * @brief Calls \p func with the name and value of each HTTP header, in the order of
+     * #GetHeaders(), without copying them.
+     *
+     * @param func A callable taking (std::string const& name, std::string const& value).
+     */
+    template <class Func> void ForEachHeader(Func&& func) const
+    {
+      // Same as iterating GetHeaders(): both maps are sorted, retry headers win over duplicates.
+      auto retryHeader = m_retryHeaders.begin();
+      auto header = m_headers.begin();
+      while (retryHeader != m_retryHeaders.end() || header != m_headers.end())
+      {
+        if (header == m_headers.end()
+            || (retryHeader != m_retryHeaders.end() && retryHeader->first <= header->first))
+        {
+          if (header != m_headers.end() && retryHeader->first == header->first)
+          {
+            ++header;
+          }
+          func(retryHeader->first, retryHeader->second);
+          ++retryHeader;
+        }
+        else
+        {
+          func(header->first, header->second);
+          ++header;
+        }
+      }
+    }
+
     /**
      * @brief Get HTTP body as #Azure::Core::Http::BodyStream.
      */
@@ -607,6 +638,7 @@ namespace Azure { namespace Core { namespace Http {
 
     std::unique_ptr<BodyStream> m_bodyStream;
     std::vector<uint8_t> m_body;
+    bool m_releaseBodyAfterDeserialization = false;
 
     explicit RawResponse(
         int32_t majorVersion,
@@ -653,6 +685,7 @@ namespace Azure { namespace Core { namespace Http {
     {
       // Copy body
       m_body = response.GetBody();
+      m_releaseBodyAfterDeserialization = response.m_releaseBodyAfterDeserialization;
     }
 
     // ===== Methods used to build HTTP response =====
@@ -711,6 +744,29 @@ namespace Azure { namespace Core { namespace Http {
      */
     void SetBody(std::vector<uint8_t> body) { this->m_body = std::move(body); }
 
+    /**
+     * @brief Set whether the body is released once it has been deserialized.
+     *
+     * @param release `true` to release the body when #OnBodyDeserialized is called.
+     */
+    void SetReleaseBodyAfterDeserialization(bool release)
+    {
+      this->m_releaseBodyAfterDeserialization = release;
+    }
+
+    /**
+     * @brief Called once the body has been deserialized into a typed value. Frees the memory of
+     * the body if #SetReleaseBodyAfterDeserialization asked for it, the status and headers are
+     * kept.
+     */
+    void OnBodyDeserialized()
+    {
+      if (this->m_releaseBodyAfterDeserialization)
+      {
+        std::vector<uint8_t>().swap(this->m_body);
+      }
+    }
+
     // adding getters for version and stream body. Clang will complain on Mac if we have unused
     // fields in a class
 
@@ -127,6 +127,16 @@ namespace Azure { namespace Core { namespace Http {
      *
      */
     std::shared_ptr<HttpTransport> Transport = Details::GetTransportAdapter();
+
+    /**
+     * @brief Release the body of a response once it has been deserialized into an
+     * #Azure::Core::Response<T>, so results that are kept around don't hold the raw body as well.
+     * The status and headers of the raw response are kept.
+     *
+     * @remark The body of a response that is read as a stream is never buffered, so it's not
+     * affected.
+     */
+    bool ReleaseBodyAfterDeserialization = false;
   };
 
   /**
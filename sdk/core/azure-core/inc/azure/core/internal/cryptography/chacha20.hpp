@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief The ChaCha20 block function (RFC 8439), used to generate random UUIDs.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Azure { namespace Core { namespace Cryptography { namespace Internal {
+
+  /**
+   * @brief Computes one 64-byte ChaCha20 keystream block (RFC 8439, section 2.3) with an all-zero
+   * nonce.
+   *
+   * @param key The 256-bit key, as eight little-endian words.
+   * @param counter The block counter.
+   * @param output Receives the 64 bytes of the block.
+   */
+  void ChaCha20Block(uint32_t const key[8], uint32_t counter, uint8_t output[64]) noexcept;
+
+}}}} // namespace Azure::Core::Cryptography::Internal
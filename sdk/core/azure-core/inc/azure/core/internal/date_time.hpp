@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Internal utility functions for dates and times.
+ *
+ */
+#pragma once
+
+#include "azure/core/datetime.hpp"
+
+#include <string>
+
+namespace Azure { namespace Core { namespace Internal {
+
+  /**
+   * @brief Get \p dateTime formatted with RFC 1123, as used by the `Date` and `x-ms-date`
+   * headers.
+   *
+   * @remark The string only changes once per second. Each thread keeps the last one it formatted
+   * and returns it again for any time within the same second, so policies stamping every request
+   * with the current time rarely format anything.
+   *
+   * @throw std::invalid_argument If year exceeds 9999.
+   */
+  std::string ToRfc1123String(DateTime const& dateTime);
+
+}}} // namespace Azure::Core::Internal
@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Internal base for deserializing JSON straight into model types.
+ *
+ */
+
+#pragma once
+
+#include "azure/core/internal/json.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Internal { namespace Json {
+
+  /**
+   * @brief Parses a JSON document without building a #json value for it, handing each value to
+   * the derived class along with where in the document it is.
+   *
+   * @remark The path of a value is the names of the object members leading to it from the root.
+   * Array elements have the path of the array, so both `paths[0].name` and `paths[1].name` are at
+   * `{"paths", "name"}`.
+   */
+  class JsonSaxHandler : public json_sax<json> {
+  public:
+    /**
+     * @brief Parses a document, calling the handler for each of its values in order.
+     *
+     * @throw json::parse_error if the document isn't valid JSON.
+     */
+    void Parse(const uint8_t* data, std::size_t length)
+    {
+      m_path.clear();
+      m_error.reset();
+      // through the base, where the event functions are public
+      if (!json::sax_parse(data, data + length, static_cast<json_sax<json>*>(this)))
+      {
+        throw *m_error;
+      }
+    }
+
+    /**
+     * @brief Parses a document, calling the handler for each of its values in order.
+     *
+     * @throw json::parse_error if the document isn't valid JSON.
+     */
+    void Parse(const std::vector<uint8_t>& document) { Parse(document.data(), document.size()); }
+
+  protected:
+    /**
+     * @brief Called when an object starts, with the path of the object.
+     */
+    virtual void OnStartObject() {}
+
+    /**
+     * @brief Called when an object ends, with the path of the object.
+     */
+    virtual void OnEndObject() {}
+
+    /**
+     * @brief Called for a string. The handler may move from it.
+     */
+    virtual void OnString(std::string& value) { (void)value; }
+
+    /**
+     * @brief Called for a number without a fraction or exponent.
+     */
+    virtual void OnInteger(int64_t value) { (void)value; }
+
+    /**
+     * @brief Called for any other number.
+     */
+    virtual void OnFloat(double value) { (void)value; }
+
+    /**
+     * @brief Called for `true` and `false`.
+     */
+    virtual void OnBoolean(bool value) { (void)value; }
+
+    /**
+     * @brief Called for `null`.
+     */
+    virtual void OnNull() {}
+
+    /**
+     * @brief Checks whether the current value is at exactly the given path.
+     */
+    bool IsAt(std::initializer_list<const char*> path) const
+    {
+      if (path.size() != m_path.size())
+      {
+        return false;
+      }
+      auto name = m_path.begin();
+      for (const char* expected : path)
+      {
+        if (*name++ != expected)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief The member names leading to the current value.
+     */
+    const std::vector<std::string>& GetPath() const { return m_path; }
+
+  private:
+    bool null() override
+    {
+      OnNull();
+      return true;
+    }
+
+    bool boolean(bool value) override
+    {
+      OnBoolean(value);
+      return true;
+    }
+
+    bool number_integer(number_integer_t value) override
+    {
+      OnInteger(static_cast<int64_t>(value));
+      return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override
+    {
+      OnInteger(static_cast<int64_t>(value));
+      return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override
+    {
+      OnFloat(static_cast<double>(value));
+      return true;
+    }
+
+    bool string(string_t& value) override
+    {
+      OnString(value);
+      return true;
+    }
+
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override
+    {
+      OnStartObject();
+      m_path.emplace_back();
+      return true;
+    }
+
+    bool key(string_t& name) override
+    {
+      // reuses the capacity of the name the previous member of the object had
+      m_path.back() = name;
+      return true;
+    }
+
+    bool end_object() override
+    {
+      m_path.pop_back();
+      OnEndObject();
+      return true;
+    }
+
+    bool start_array(std::size_t) override { return true; }
+
+    bool end_array() override { return true; }
+
+    bool parse_error(std::size_t position, const std::string&, const detail::exception& ex) override
+    {
+      // kept for Parse to throw, the reference doesn't outlive this call; number overflows arrive
+      // as out_of_range and are reported as parse errors too
+      auto parseError = dynamic_cast<const json::parse_error*>(&ex);
+      m_error = std::make_unique<json::parse_error>(
+          parseError != nullptr ? *parseError
+                                : json::parse_error::create(101, position, ex.what()));
+      return false;
+    }
+
+    std::vector<std::string> m_path;
+    std::unique_ptr<json::parse_error> m_error;
+  };
+
+}}}} // namespace Azure::Core::Internal::Json
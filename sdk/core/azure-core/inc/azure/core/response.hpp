@@ -27,6 +27,9 @@ namespace Azure { namespace Core {
     /**
      * @brief Initialize a #Azure::Core::Response<T> with an initial value.
      *
+     * @remark The value is expected to have been deserialized from the raw response, whose body
+     * is released if the transport policy was asked to.
+     *
      * @param initialValue Initial value.
      * @param rawResponse Raw HTTP response.
      */
@@ -34,6 +37,10 @@ namespace Azure { namespace Core {
     explicit Response(T initialValue, std::unique_ptr<Http::RawResponse>&& rawResponse)
         : m_value(std::move(initialValue)), m_rawResponse(std::move(rawResponse))
     {
+      if (this->m_rawResponse)
+      {
+        this->m_rawResponse->OnBodyDeserialized();
+      }
     }
 
     /**
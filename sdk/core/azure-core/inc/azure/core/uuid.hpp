@@ -8,9 +8,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <new> // for placement new
-#include <random>
 #include <string>
 #include <utility> // for swap and move
 
@@ -38,59 +38,14 @@ namespace Azure { namespace Core {
      * Gets UUID as a string.
      * @details A string is in canonical format (4-2-2-2-6 lowercase hex and dashes only)
      */
-    std::string ToString()
-    {
-      // Guid is 36 characters
-      //  Add one byte for the \0
-      char s[37];
-
-      std::snprintf(
-          s,
-          sizeof(s),
-          "%2.2x%2.2x%2.2x%2.2x-%2.2x%2.2x-%2.2x%2.2x-%2.2x%2.2x-%2.2x%2.2x%2.2x%2.2x%2.2x%2.2x",
-          m_uuid[0],
-          m_uuid[1],
-          m_uuid[2],
-          m_uuid[3],
-          m_uuid[4],
-          m_uuid[5],
-          m_uuid[6],
-          m_uuid[7],
-          m_uuid[8],
-          m_uuid[9],
-          m_uuid[10],
-          m_uuid[11],
-          m_uuid[12],
-          m_uuid[13],
-          m_uuid[14],
-          m_uuid[15]);
-
-      return std::string(s);
-    }
+    std::string ToString() const;
 
     /**
      * @brief Create a new random UUID.
+     *
+     * @remark The random bytes come from a cryptographically secure generator that each thread
+     * seeds once from the operating system.
      */
-    static Uuid CreateUuid()
-    {
-      std::random_device rd;
-
-      uint8_t uuid[UuidSize] = {};
-
-      for (int i = 0; i < UuidSize; i += 4)
-      {
-        const uint32_t x = rd();
-        std::memcpy(uuid + i, &x, 4);
-      }
-
-      // SetVariant to ReservedRFC4122
-      uuid[8] = (uuid[8] | ReservedRFC4122) & 0x7F;
-
-      constexpr uint8_t version = 4;
-
-      uuid[6] = (uuid[6] & 0xF) | (version << 4);
-
-      return Uuid(uuid);
-    }
+    static Uuid CreateUuid();
   };
 }} // namespace Azure::Core
@@ -2,95 +2,151 @@
 // SPDX-License-Identifier: MIT
 
 #include "azure/core/base64.hpp"
-#include "azure/core/platform.hpp"
-
-#if defined(AZ_PLATFORM_WINDOWS)
-#include <windows.h>
-#elif defined(AZ_PLATFORM_POSIX)
-#include <openssl/bio.h>
-#include <openssl/buffer.h>
-#include <openssl/evp.h>
-#endif
 
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace Azure { namespace Core {
 
-#if defined(AZ_PLATFORM_WINDOWS)
-
-  std::string Base64Encode(const std::vector<uint8_t>& data)
+  namespace {
+    constexpr char Base64EncodeTable[]
+        = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    // Value of each base 64 character, 255 for characters that aren't part of the alphabet.
+    constexpr uint8_t Base64DecodeTable[256] = {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 62, 255, 255, 255, 63, 52, 53, 54, 55, 56, 57, 58, 59,
+        60, 61, 255, 255, 255, 255, 255, 255, 255, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 255, 255, 255, 255, 255, 255, 26, 27, 28, 29,
+        30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255};
+
+    [[noreturn]] void ThrowInvalidBase64()
+    {
+      throw std::invalid_argument("Unexpected character or length in base 64 encoded text.");
+    }
+  } // namespace
+
+  std::size_t Base64Encode(const uint8_t* data, std::size_t length, char* output)
   {
-    std::string encoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4
-    DWORD encodedLength = static_cast<DWORD>((data.size() + 2) / 3 * 4);
-    encoded.resize(encodedLength);
-
-    CryptBinaryToStringA(
-        reinterpret_cast<const BYTE*>(data.data()),
-        static_cast<DWORD>(data.size()),
-        CRYPT_STRING_BASE64 | CRYPT_STRING_NOCRLF,
-        static_cast<LPSTR>(&encoded[0]),
-        &encodedLength);
+    char* out = output;
+    std::size_t i = 0;
+    for (; i + 3 <= length; i += 3)
+    {
+      const uint32_t triple
+          = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+      out[0] = Base64EncodeTable[(triple >> 18) & 0x3F];
+      out[1] = Base64EncodeTable[(triple >> 12) & 0x3F];
+      out[2] = Base64EncodeTable[(triple >> 6) & 0x3F];
+      out[3] = Base64EncodeTable[triple & 0x3F];
+      out += 4;
+    }
+
+    if (i + 1 == length)
+    {
+      const uint32_t triple = uint32_t(data[i]) << 16;
+      out[0] = Base64EncodeTable[(triple >> 18) & 0x3F];
+      out[1] = Base64EncodeTable[(triple >> 12) & 0x3F];
+      out[2] = '=';
+      out[3] = '=';
+      out += 4;
+    }
+    else if (i + 2 == length)
+    {
+      const uint32_t triple = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8);
+      out[0] = Base64EncodeTable[(triple >> 18) & 0x3F];
+      out[1] = Base64EncodeTable[(triple >> 12) & 0x3F];
+      out[2] = Base64EncodeTable[(triple >> 6) & 0x3F];
+      out[3] = '=';
+      out += 4;
+    }
+    return static_cast<std::size_t>(out - output);
+  }
 
+  std::string Base64Encode(const uint8_t* data, std::size_t length)
+  {
+    std::string encoded(Base64EncodedLength(length), '\0');
+    if (!encoded.empty())
+    {
+      Base64Encode(data, length, &encoded[0]);
+    }
     return encoded;
   }
 
-  std::vector<uint8_t> Base64Decode(const std::string& text)
+  std::string Base64Encode(const std::vector<uint8_t>& data)
   {
-    std::vector<uint8_t> decoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4, so we can infer an
-    // upper bound here
-    DWORD decodedLength = DWORD(text.length() / 4 * 3);
-    decoded.resize(decodedLength);
-
-    CryptStringToBinaryA(
-        text.data(),
-        static_cast<DWORD>(text.length()),
-        CRYPT_STRING_BASE64 | CRYPT_STRING_STRICT,
-        reinterpret_cast<BYTE*>(decoded.data()),
-        &decodedLength,
-        nullptr,
-        nullptr);
-    decoded.resize(decodedLength);
-    return decoded;
+    return Base64Encode(data.data(), data.size());
   }
 
-#elif defined(AZ_PLATFORM_POSIX)
-
-  std::string Base64Encode(const std::vector<uint8_t>& data)
+  std::size_t Base64Decode(const char* text, std::size_t length, uint8_t* output)
   {
-    BIO* bio = BIO_new(BIO_s_mem());
-    bio = BIO_push(BIO_new(BIO_f_base64()), bio);
-    BIO_set_flags(bio, BIO_FLAGS_BASE64_NO_NL);
-    BIO_write(bio, data.data(), static_cast<int>(data.size()));
-    BIO_flush(bio);
-    BUF_MEM* bufferPtr;
-    BIO_get_mem_ptr(bio, &bufferPtr);
-    BIO_set_close(bio, BIO_NOCLOSE);
-    BIO_free_all(bio);
-
-    return std::string(bufferPtr->data, bufferPtr->length);
+    if (length % 4 == 0 && length != 0 && text[length - 1] == '=')
+    {
+      length -= text[length - 2] == '=' ? 2 : 1;
+    }
+    if (length % 4 == 1)
+    {
+      ThrowInvalidBase64();
+    }
+
+    const auto decode = [text](std::size_t i) {
+      return uint32_t(Base64DecodeTable[static_cast<unsigned char>(text[i])]);
+    };
+
+    uint8_t* out = output;
+    std::size_t i = 0;
+    for (; i + 4 <= length; i += 4)
+    {
+      const uint32_t a = decode(i);
+      const uint32_t b = decode(i + 1);
+      const uint32_t c = decode(i + 2);
+      const uint32_t d = decode(i + 3);
+      // Invalid characters decode to 255, which is the only value with the high bit set.
+      if ((a | b | c | d) & 0x80)
+      {
+        ThrowInvalidBase64();
+      }
+      const uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+      out[0] = static_cast<uint8_t>(triple >> 16);
+      out[1] = static_cast<uint8_t>(triple >> 8);
+      out[2] = static_cast<uint8_t>(triple);
+      out += 3;
+    }
+
+    if (i < length)
+    {
+      // Two or three characters left, which encode one or two bytes.
+      const uint32_t a = decode(i);
+      const uint32_t b = decode(i + 1);
+      const uint32_t c = i + 2 < length ? decode(i + 2) : 0;
+      if ((a | b | c) & 0x80)
+      {
+        ThrowInvalidBase64();
+      }
+      const uint32_t triple = (a << 18) | (b << 12) | (c << 6);
+      *out++ = static_cast<uint8_t>(triple >> 16);
+      if (i + 2 < length)
+      {
+        *out++ = static_cast<uint8_t>(triple >> 8);
+      }
+    }
+    return static_cast<std::size_t>(out - output);
   }
 
   std::vector<uint8_t> Base64Decode(const std::string& text)
   {
-    std::vector<uint8_t> decoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4, so we can infer an
-    // upper bound here
-    std::size_t maxDecodedLength = text.length() / 4 * 3;
-    decoded.resize(maxDecodedLength);
-
-    BIO* bio = BIO_new_mem_buf(text.data(), -1);
-    bio = BIO_push(BIO_new(BIO_f_base64()), bio);
-    BIO_set_flags(bio, BIO_FLAGS_BASE64_NO_NL);
-    int decodedLength = BIO_read(bio, &decoded[0], static_cast<int>(text.length()));
-    BIO_free_all(bio);
-
-    decoded.resize(decodedLength);
+    std::vector<uint8_t> decoded(Base64DecodedMaxLength(text.length()));
+    decoded.resize(Base64Decode(text.data(), text.length(), decoded.data()));
     return decoded;
   }
 
-#endif
-
 }} // namespace Azure::Core
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/internal/cryptography/chacha20.hpp"
+
+#include <cstring>
+
+namespace {
+
+uint32_t RotateLeft(uint32_t value, int bits) { return (value << bits) | (value >> (32 - bits)); }
+
+void QuarterRound(uint32_t* x, int a, int b, int c, int d)
+{
+  x[a] += x[b];
+  x[d] = RotateLeft(x[d] ^ x[a], 16);
+  x[c] += x[d];
+  x[b] = RotateLeft(x[b] ^ x[c], 12);
+  x[a] += x[b];
+  x[d] = RotateLeft(x[d] ^ x[a], 8);
+  x[c] += x[d];
+  x[b] = RotateLeft(x[b] ^ x[c], 7);
+}
+
+} // namespace
+
+namespace Azure { namespace Core { namespace Cryptography { namespace Internal {
+
+  void ChaCha20Block(uint32_t const key[8], uint32_t counter, uint8_t output[64]) noexcept
+  {
+    uint32_t const input[16] = {
+        0x61707865,
+        0x3320646e,
+        0x79622d32,
+        0x6b206574,
+        key[0],
+        key[1],
+        key[2],
+        key[3],
+        key[4],
+        key[5],
+        key[6],
+        key[7],
+        counter,
+        0,
+        0,
+        0};
+    uint32_t x[16];
+    std::memcpy(x, input, sizeof(x));
+    for (int i = 0; i < 10; ++i)
+    {
+      QuarterRound(x, 0, 4, 8, 12);
+      QuarterRound(x, 1, 5, 9, 13);
+      QuarterRound(x, 2, 6, 10, 14);
+      QuarterRound(x, 3, 7, 11, 15);
+      QuarterRound(x, 0, 5, 10, 15);
+      QuarterRound(x, 1, 6, 11, 12);
+      QuarterRound(x, 2, 7, 8, 13);
+      QuarterRound(x, 3, 4, 9, 14);
+    }
+    for (int i = 0; i < 16; ++i)
+    {
+      uint32_t const word = x[i] + input[i];
+      output[i * 4] = static_cast<uint8_t>(word);
+      output[i * 4 + 1] = static_cast<uint8_t>(word >> 8);
+      output[i * 4 + 2] = static_cast<uint8_t>(word >> 16);
+      output[i * 4 + 3] = static_cast<uint8_t>(word >> 24);
+    }
+  }
+
+}}}} // namespace Azure::Core::Cryptography::Internal
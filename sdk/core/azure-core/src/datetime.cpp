@@ -2,14 +2,13 @@
 // SPDX-License-Identifier: MIT
 
 #include "azure/core/datetime.hpp"
+#include "azure/core/internal/date_time.hpp"
 #include "azure/core/platform.hpp"
 
 #include <algorithm>
 #include <cctype>
 #include <ctime>
-#include <iomanip>
 #include <limits>
-#include <sstream>
 #include <stdexcept>
 
 using namespace Azure::Core;
@@ -359,6 +358,99 @@ void ParseSingleOptionalChar(
     IncreaseAndCheckMinLength(minLength, actualLength, 1);
   }
 }
+
+// Reads exactly `count` digits, returns false if any of them is not a digit.
+bool ParseFixedDigits(char const* str, int count, int* value)
+{
+  int result = 0;
+  for (int i = 0; i < count; ++i)
+  {
+    auto const digit = static_cast<unsigned>(str[i] - '0');
+    if (digit > 9)
+    {
+      return false;
+    }
+    result = result * 10 + static_cast<int>(digit);
+  }
+  *value = result;
+  return true;
+}
+
+// Writes value with exactly `count` digits, zero padded.
+char* WriteFixedDigits(char* out, int value, int count)
+{
+  for (int i = count - 1; i >= 0; --i)
+  {
+    out[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return out + count;
+}
+
+struct DateTimeFields
+{
+  int year;
+  int month;
+  int day;
+  int hour;
+  int minute;
+  int second;
+  int fracSec;
+  int dayOfWeek;
+};
+
+// "Thu, 18 Feb 2021 08:00:00 GMT", the form services send in headers and listings.
+bool TryParseCanonicalRfc1123(std::string const& str, DateTimeFields* fields)
+{
+  constexpr std::string::size_type CanonicalLength = 29;
+  if (str.length() != CanonicalLength || str[3] != ',' || str[4] != ' ' || str[7] != ' '
+      || str[11] != ' ' || str[16] != ' ' || str[19] != ':' || str[22] != ':' || str[25] != ' '
+      || str.compare(26, 3, "GMT") != 0)
+  {
+    return false;
+  }
+
+  fields->dayOfWeek = SubstringEqualsAny(str, 0, 3, DayNames);
+  fields->month = 1 + SubstringEqualsAny(str, 8, 3, MonthNames);
+  fields->fracSec = 0;
+  return fields->dayOfWeek >= 0 && fields->month > 0 && ParseFixedDigits(&str[5], 2, &fields->day)
+      && ParseFixedDigits(&str[12], 4, &fields->year)
+      && ParseFixedDigits(&str[17], 2, &fields->hour)
+      && ParseFixedDigits(&str[20], 2, &fields->minute)
+      && ParseFixedDigits(&str[23], 2, &fields->second);
+}
+
+// "2021-02-18T08:00:00Z" or "2021-02-18T08:00:00.1234567Z", with up to 7 fractional digits.
+bool TryParseCanonicalRfc3339(std::string const& str, DateTimeFields* fields)
+{
+  auto const length = str.length();
+  if (length < 20 || str[4] != '-' || str[7] != '-' || (str[10] != 'T' && str[10] != 't')
+      || str[13] != ':' || str[16] != ':' || str[length - 1] != 'Z')
+  {
+    return false;
+  }
+
+  fields->fracSec = 0;
+  if (length != 20)
+  {
+    auto const fractionDigits = static_cast<int>(length - 21);
+    if (str[19] != '.' || fractionDigits < 1 || fractionDigits > 7
+        || !ParseFixedDigits(&str[20], fractionDigits, &fields->fracSec))
+    {
+      return false;
+    }
+    for (auto i = fractionDigits; i < 7; ++i)
+    {
+      fields->fracSec *= 10;
+    }
+  }
+
+  fields->dayOfWeek = -1;
+  return ParseFixedDigits(&str[0], 4, &fields->year) && ParseFixedDigits(&str[5], 2, &fields->month)
+      && ParseFixedDigits(&str[8], 2, &fields->day) && ParseFixedDigits(&str[11], 2, &fields->hour)
+      && ParseFixedDigits(&str[14], 2, &fields->minute)
+      && ParseFixedDigits(&str[17], 2, &fields->second);
+}
 } // namespace
 
 DateTime const DateTime::SystemClockEpoch = GetSystemClockEpoch();
@@ -424,6 +516,27 @@ DateTime::operator std::chrono::system_clock::time_point() const
 
 DateTime DateTime::Parse(std::string const& dateTime, DateFormat format)
 {
+  // Fixed width forms are read without the bookkeeping of the general parser below, which handles
+  // everything else the formats allow.
+  {
+    DateTimeFields fields;
+    if ((format == DateFormat::Rfc1123 && TryParseCanonicalRfc1123(dateTime, &fields))
+        || (format == DateFormat::Rfc3339 && TryParseCanonicalRfc3339(dateTime, &fields)))
+    {
+      return DateTime(
+          static_cast<int16_t>(fields.year),
+          static_cast<int8_t>(fields.month),
+          static_cast<int8_t>(fields.day),
+          static_cast<int8_t>(fields.hour),
+          static_cast<int8_t>(fields.minute),
+          static_cast<int8_t>(fields.second),
+          fields.fracSec,
+          static_cast<int8_t>(fields.dayOfWeek),
+          0,
+          0);
+    }
+  }
+
   // The values that are not supposed to be read before they are written are set to -123... to avoid
   // warnings on some compilers, yet provide a clearly bad value to make it obvious if things don't
   // work as expected.
@@ -792,46 +905,63 @@ std::string DateTime::ToString(DateFormat format, TimeFractionFormat fractionFor
     fracSec = static_cast<int32_t>(remainder);
   }
 
-  std::ostringstream dateString;
+  // "9999-12-31T23:59:59.9999999Z" and "Fri, 31 Dec 9999 23:59:59 GMT" both fit
+  char buffer[32];
+  char* out = buffer;
   if (format == DateFormat::Rfc3339)
   {
-    dateString << std::setfill('0') << std::setw(4) << static_cast<int>(year) << '-' << std::setw(2)
-               << static_cast<int>(month) << '-' << std::setw(2) << static_cast<int>(day) << 'T'
-               << std::setw(2) << static_cast<int>(hour) << ':' << std::setw(2)
-               << static_cast<int>(minute) << ':' << std::setw(2) << static_cast<int>(second);
+    out = WriteFixedDigits(out, year, 4);
+    *out++ = '-';
+    out = WriteFixedDigits(out, month, 2);
+    *out++ = '-';
+    out = WriteFixedDigits(out, day, 2);
+    *out++ = 'T';
+    out = WriteFixedDigits(out, hour, 2);
+    *out++ = ':';
+    out = WriteFixedDigits(out, minute, 2);
+    *out++ = ':';
+    out = WriteFixedDigits(out, second, 2);
 
     if (fractionFormat == TimeFractionFormat::AllDigits)
     {
-      dateString << '.' << std::setw(7) << static_cast<int>(fracSec);
+      *out++ = '.';
+      out = WriteFixedDigits(out, fracSec, 7);
     }
     else if (fracSec != 0 && fractionFormat != TimeFractionFormat::Truncate)
     {
       // Append fractional second, which is a 7-digit value with no trailing zeros
       // This way, '0001200' becomes '00012'
-      auto setw = 1;
+      auto digits = 7;
       auto frac = fracSec;
-      for (auto div = 1000000; div >= 1; div /= 10)
+      while (frac % 10 == 0)
       {
-        if ((fracSec % div) == 0)
-        {
-          frac /= div;
-          break;
-        }
-        ++setw;
+        frac /= 10;
+        --digits;
       }
 
-      dateString << '.' << std::setw(setw) << static_cast<int>(frac);
+      *out++ = '.';
+      out = WriteFixedDigits(out, frac, digits);
     }
 
-    dateString << 'Z';
+    *out++ = 'Z';
   }
   else if (format == DateFormat::Rfc1123)
   {
-    dateString << DayNames[dayOfWeek] << ", " << std::setfill('0') << std::setw(2)
-               << static_cast<int>(day) << ' ' << MonthNames[month - 1] << ' ' << std::setw(4)
-               << static_cast<int>(year) << ' ' << std::setw(2) << static_cast<int>(hour) << ':'
-               << std::setw(2) << static_cast<int>(minute) << ':' << std::setw(2)
-               << static_cast<int>(second) << " GMT";
+    out = std::copy(DayNames[dayOfWeek].begin(), DayNames[dayOfWeek].end(), out);
+    *out++ = ',';
+    *out++ = ' ';
+    out = WriteFixedDigits(out, day, 2);
+    *out++ = ' ';
+    out = std::copy(MonthNames[month - 1].begin(), MonthNames[month - 1].end(), out);
+    *out++ = ' ';
+    out = WriteFixedDigits(out, year, 4);
+    *out++ = ' ';
+    out = WriteFixedDigits(out, hour, 2);
+    *out++ = ':';
+    out = WriteFixedDigits(out, minute, 2);
+    *out++ = ':';
+    out = WriteFixedDigits(out, second, 2);
+    out = std::copy_n(" GMT", 4, out);
   }
   else
   {
@@ -839,5 +969,25 @@ std::string DateTime::ToString(DateFormat format, TimeFractionFormat fractionFor
         "Unrecognized date format (" + std::to_string(static_cast<int64_t>(format)) + ").");
   }
 
-  return dateString.str();
+  return std::string(buffer, out);
+}
+
+std::string Azure::Core::Internal::ToRfc1123String(DateTime const& dateTime)
+{
+  auto const ticks = dateTime.time_since_epoch().count();
+  if (ticks < 0)
+  {
+    // let ToString() report the date out of range
+    return dateTime.ToString(DateTime::DateFormat::Rfc1123);
+  }
+  auto const second = ticks / OneSecondIn100ns;
+
+  static thread_local int64_t cachedSecond = -1;
+  static thread_local std::string cachedString;
+  if (second != cachedSecond)
+  {
+    cachedString = dateTime.ToString(DateTime::DateFormat::Rfc1123);
+    cachedSecond = second;
+  }
+  return cachedString;
 }
@@ -131,12 +131,13 @@ std::unique_ptr<RawResponse> Azure::Core::Http::RetryPolicy::Send(
 {
   auto const shouldLog = Logging::Internal::ShouldLog(Logging::LogLevel::Informational);
 
+  // creates a copy of original query parameters from request, once for all the attempts
+  auto const originalQueryParameters = request.GetUrl().GetQueryParameters();
+
   for (RetryNumber attempt = 1;; ++attempt)
   {
     Delay retryAfter{};
     request.StartTry();
-    // creates a copy of original query parameters from request
-    auto originalQueryParameters = request.GetUrl().GetQueryParameters();
     try
     {
       auto response = nextHttpPolicy.Send(ctx, request);
@@ -182,6 +183,6 @@ std::unique_ptr<RawResponse> Azure::Core::Http::RetryPolicy::Send(
     }
 
     // Restore the original query parameters before next retry
-    request.GetUrl().SetQueryParameters(std::move(originalQueryParameters));
+    request.GetUrl().SetQueryParameters(originalQueryParameters);
   }
 }
@@ -57,6 +57,7 @@ std::unique_ptr<RawResponse> TransportPolicy::Send(
   // body
   auto bodyStream = response->GetBodyStream();
   response->SetBody(BodyStream::ReadToEnd(ctx, *bodyStream));
+  response->SetReleaseBodyAfterDeserialization(m_options.ReleaseBodyAfterDeserialization);
   // BodyStream is moved out of response. This makes transport implementation to clean any active
   // session with sockets or internal state.
   return response;
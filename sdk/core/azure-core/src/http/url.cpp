@@ -5,10 +5,10 @@
 #include "azure/core/internal/strings.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <iterator>
 #include <limits>
-#include <vector>
 
 using namespace Azure::Core::Http;
 
@@ -75,46 +75,96 @@ Url::Url(const std::string& url)
   }
 }
 
-std::string Url::Decode(const std::string& value)
+namespace {
+// Value of each hex digit, or -1 for any other character.
+const std::array<int8_t, 256>& HexDigitValues()
 {
-  const static std::vector<int> hexTable = []() {
-    std::vector<int> t(256, -1);
+  static const std::array<int8_t, 256> table = []() {
+    std::array<int8_t, 256> t;
+    t.fill(-1);
     for (int i = 0; i < 10; ++i)
     {
-      t[static_cast<std::size_t>('0') + i] = i;
+      t[static_cast<std::size_t>('0' + i)] = static_cast<int8_t>(i);
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+      t[static_cast<std::size_t>('A' + i)] = static_cast<int8_t>(10 + i);
+      t[static_cast<std::size_t>('a' + i)] = static_cast<int8_t>(10 + i);
+    }
+    return t;
+  }();
+  return table;
+}
+
+// Unreserved characters (RFC 3986), which are never encoded.
+const std::array<bool, 256>& UnreservedCharacters()
+{
+  static const std::array<bool, 256> table = []() {
+    std::array<bool, 256> t;
+    t.fill(false);
+    for (unsigned char c = 'a'; c <= 'z'; ++c)
+    {
+      t[c] = true;
+    }
+    for (unsigned char c = 'A'; c <= 'Z'; ++c)
+    {
+      t[c] = true;
     }
-    for (int i = 10; i < 16; ++i)
+    for (unsigned char c = '0'; c <= '9'; ++c)
     {
-      t[static_cast<std::size_t>('A') + i - 10] = i;
-      t[static_cast<std::size_t>('a') + i - 10] = i;
+      t[c] = true;
+    }
+    for (unsigned char c : {'-', '.', '_', '~'})
+    {
+      t[c] = true;
     }
     return t;
   }();
+  return table;
+}
+} // namespace
+
+std::string Url::Decode(const std::string& value)
+{
+  const auto& hexTable = HexDigitValues();
+
+  auto isEscape = [](char c) { return c == '%' || c == '+'; };
+  auto runEnd = std::find_if(value.begin(), value.end(), isEscape);
+  if (runEnd == value.end())
+  {
+    return value;
+  }
 
   std::string decodedValue;
-  for (std::size_t i = 0; i < value.size();)
+  decodedValue.reserve(value.size());
+  auto cur = value.begin();
+  while (true)
   {
-    char c = value[i];
-    if (c == '+')
+    decodedValue.append(cur, runEnd);
+    if (runEnd == value.end())
+    {
+      break;
+    }
+    std::size_t i = static_cast<std::size_t>(runEnd - value.begin());
+    if (value[i] == '+')
     {
       decodedValue += ' ';
-      ++i;
+      i += 1;
     }
-    else if (c == '%')
+    else
     {
-      if (i + 2 >= value.size() || hexTable[value[i + 1]] < 0 || hexTable[value[i + 2]] < 0)
+      if (i + 2 >= value.size() || hexTable[static_cast<unsigned char>(value[i + 1])] < 0
+          || hexTable[static_cast<unsigned char>(value[i + 2])] < 0)
       {
         throw std::runtime_error("failed when decoding url component");
       }
-      int v = (hexTable[value[i + 1]] << 4) + hexTable[value[i + 2]];
+      int v = (hexTable[static_cast<unsigned char>(value[i + 1])] << 4)
+          + hexTable[static_cast<unsigned char>(value[i + 2])];
       decodedValue += static_cast<std::string::value_type>(v);
       i += 3;
     }
-    else
-    {
-      decodedValue += value[i];
-      ++i;
-    }
+    cur = value.begin() + i;
+    runEnd = std::find_if(cur, value.end(), isEscape);
   }
   return decodedValue;
 }
@@ -122,26 +172,38 @@ std::string Url::Decode(const std::string& value)
 std::string Url::Encode(const std::string& value, const std::string& doNotEncodeSymbols)
 {
   const char* hex = "0123456789ABCDEF";
-  std::unordered_set<unsigned char> noEncodingSymbolsSet(
-      doNotEncodeSymbols.begin(), doNotEncodeSymbols.end());
+
+  std::array<bool, 256> noEncodingTable = UnreservedCharacters();
+  for (char c : doNotEncodeSymbols)
+  {
+    noEncodingTable[static_cast<unsigned char>(c)] = true;
+  }
+  auto needsEncoding
+      = [&noEncodingTable](char c) { return !noEncodingTable[static_cast<unsigned char>(c)]; };
+
+  auto runEnd = std::find_if(value.begin(), value.end(), needsEncoding);
+  if (runEnd == value.end())
+  {
+    return value;
+  }
 
   std::string encoded;
-  for (char c : value)
+  encoded.reserve(value.size() + value.size() / 2);
+  auto cur = value.begin();
+  while (true)
   {
-    unsigned char uc = c;
-    // encode if char is not in the default non-encoding set AND if it is NOT in chars to ignore
-    // from user input
-    if (defaultNonUrlEncodeChars.find(uc) == defaultNonUrlEncodeChars.end()
-        && noEncodingSymbolsSet.find(uc) == noEncodingSymbolsSet.end())
-    {
-      encoded += '%';
-      encoded += hex[(uc >> 4) & 0x0f];
-      encoded += hex[uc & 0x0f];
-    }
-    else
+    // characters that are kept as they are get copied a run at a time
+    encoded.append(cur, runEnd);
+    if (runEnd == value.end())
     {
-      encoded += c;
+      break;
     }
+    unsigned char uc = static_cast<unsigned char>(*runEnd);
+    encoded += '%';
+    encoded += hex[(uc >> 4) & 0x0f];
+    encoded += hex[uc & 0x0f];
+    cur = runEnd + 1;
+    runEnd = std::find_if(cur, value.end(), needsEncoding);
   }
   return encoded;
 }
@@ -177,47 +239,60 @@ void Url::AppendQueryParameters(const std::string& query)
   }
 }
 
-std::string Url::GetRelativeUrl() const
+void Url::AppendRelativeUrl(std::string& url) const
 {
-  std::string relative_url;
-  if (!m_encodedPath.empty())
+  url += m_encodedPath;
+  char separator = '?';
+  for (const auto& q : m_encodedQueryParameters)
   {
-    relative_url += m_encodedPath;
+    url += separator;
+    url += q.first;
+    url += '=';
+    url += q.second;
+    separator = '&';
   }
+}
+
+std::size_t Url::GetRelativeUrlLength() const
+{
+  std::size_t length = m_encodedPath.size();
+  for (const auto& q : m_encodedQueryParameters)
   {
-    relative_url += '?';
-    for (const auto& q : m_encodedQueryParameters)
-    {
-      relative_url += q.first + '=' + q.second + '&';
-    }
-    relative_url.pop_back();
+    length += q.first.size() + q.second.size() + 2;
   }
+  return length;
+}
 
-  return relative_url;
+std::string Url::GetRelativeUrl() const
+{
+  std::string relativeUrl;
+  relativeUrl.reserve(GetRelativeUrlLength());
+  AppendRelativeUrl(relativeUrl);
+  return relativeUrl;
 }
 
 std::string Url::GetAbsoluteUrl() const
 {
-  std::string full_url;
+  std::string port = m_port != 0 ? std::to_string(m_port) : std::string();
+
+  std::string fullUrl;
+  // "://", ":" and "/" are the only separators around the relative part
+  fullUrl.reserve(m_scheme.size() + m_host.size() + port.size() + GetRelativeUrlLength() + 5);
   if (!m_scheme.empty())
   {
-    full_url += m_scheme + "://";
+    fullUrl += m_scheme;
+    fullUrl += "://";
   }
-  full_url += m_host;
-  if (m_port != 0)
+  fullUrl += m_host;
+  if (!port.empty())
   {
-    full_url += ":" + std::to_string(m_port);
+    fullUrl += ':';
+    fullUrl += port;
   }
   if (!m_encodedPath.empty())
   {
-    full_url += "/";
+    fullUrl += '/';
   }
-  full_url += GetRelativeUrl();
-  return full_url;
+  AppendRelativeUrl(fullUrl);
+  return fullUrl;
 }
-
-const std::unordered_set<unsigned char> Url::defaultNonUrlEncodeChars
-    = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q',
-       'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-       'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y',
-       'Z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '.', '_', '~'};
@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/uuid.hpp"
+#include "azure/core/internal/cryptography/chacha20.hpp"
+#include "azure/core/platform.hpp"
+
+#if defined(AZ_PLATFORM_POSIX)
+#include <pthread.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+namespace {
+
+#if defined(AZ_PLATFORM_POSIX)
+// Bumped in the child after every fork, so generators know their state was duplicated.
+std::atomic<uint64_t> ForkGeneration(0);
+
+void OnForkInChild() { ForkGeneration.fetch_add(1); }
+#endif
+
+// ChaCha20 (RFC 8439) used as a "fast key erasure" generator: each refill derives a new key from
+// the keystream, then discards the old one, and every byte handed out is wiped from the buffer.
+class RandomGenerator {
+private:
+  static constexpr std::size_t KeySize = 32;
+  static constexpr std::size_t BlockSize = 64;
+  static constexpr std::size_t BlocksPerRefill = 4;
+
+  uint32_t m_key[KeySize / 4];
+  uint8_t m_buffer[BlockSize * BlocksPerRefill];
+  std::size_t m_available = 0;
+#if defined(AZ_PLATFORM_POSIX)
+  uint64_t m_forkGeneration = 0;
+#endif
+
+  void Seed()
+  {
+    std::random_device rd;
+    for (auto& word : m_key)
+    {
+      word = rd();
+    }
+    m_available = 0;
+  }
+
+  void Refill()
+  {
+    for (uint32_t i = 0; i < BlocksPerRefill; ++i)
+    {
+      Azure::Core::Cryptography::Internal::ChaCha20Block(m_key, i, m_buffer + i * BlockSize);
+    }
+    std::memcpy(m_key, m_buffer, KeySize);
+    std::memset(m_buffer, 0, KeySize);
+    m_available = sizeof(m_buffer) - KeySize;
+  }
+
+public:
+  RandomGenerator()
+  {
+#if defined(AZ_PLATFORM_POSIX)
+    static int const forkHandlerRegistered = pthread_atfork(nullptr, nullptr, OnForkInChild);
+    (void)forkHandlerRegistered;
+    m_forkGeneration = ForkGeneration.load(std::memory_order_relaxed);
+#endif
+    Seed();
+  }
+
+  void Generate(uint8_t* output, std::size_t length)
+  {
+#if defined(AZ_PLATFORM_POSIX)
+    // a forked child must not hand out the same values as its parent
+    auto const forkGeneration = ForkGeneration.load(std::memory_order_relaxed);
+    if (forkGeneration != m_forkGeneration)
+    {
+      Seed();
+      m_forkGeneration = forkGeneration;
+    }
+#endif
+    while (length > 0)
+    {
+      if (m_available == 0)
+      {
+        Refill();
+      }
+      std::size_t const count = std::min(length, m_available);
+      uint8_t* source = m_buffer + sizeof(m_buffer) - m_available;
+      std::memcpy(output, source, count);
+      std::memset(source, 0, count);
+      output += count;
+      length -= count;
+      m_available -= count;
+    }
+  }
+};
+
+} // namespace
+
+namespace Azure { namespace Core {
+
+  std::string Uuid::ToString() const
+  {
+    static constexpr char Hex[] = "0123456789abcdef";
+
+    // 8-4-4-4-12
+    std::string s(36, '-');
+    std::size_t position = 0;
+    for (int i = 0; i < UuidSize; ++i)
+    {
+      if (i == 4 || i == 6 || i == 8 || i == 10)
+      {
+        ++position;
+      }
+      s[position++] = Hex[m_uuid[i] >> 4];
+      s[position++] = Hex[m_uuid[i] & 0x0f];
+    }
+    return s;
+  }
+
+  Uuid Uuid::CreateUuid()
+  {
+    // seeded from the OS once per thread, instead of asking it for every UUID
+    static thread_local RandomGenerator generator;
+
+    uint8_t uuid[UuidSize];
+    generator.Generate(uuid, UuidSize);
+
+    // SetVariant to ReservedRFC4122
+    uuid[8] = (uuid[8] | ReservedRFC4122) & 0x7F;
+
+    constexpr uint8_t version = 4;
+
+    uuid[6] = (uuid[6] & 0xF) | (version << 4);
+
+    return Uuid(uuid);
+  }
+
+}} // namespace Azure::Core
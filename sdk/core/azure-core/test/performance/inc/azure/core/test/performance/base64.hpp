@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the base 64 encoding and decoding performance.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/base64.hpp>
+#include <azure/performance_framework.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test { namespace Performance {
+
+  /**
+   * @brief Measure encoding binary data to base 64 and decoding it back.
+   *
+   * @remark The default size of 32 bytes is the size of an account key or a signature, the most
+   * frequently encoded data.
+   */
+  class Base64Test : public Azure::PerformanceStress::PerformanceTest {
+  private:
+    std::vector<uint8_t> m_data;
+    std::string m_text;
+    std::vector<uint8_t> m_decoded;
+    bool m_useBuffers = false;
+
+  public:
+    /**
+     * @brief Construct a new Base64 test.
+     *
+     * @param options The test options.
+     */
+    Base64Test(Azure::PerformanceStress::TestOptions options) : PerformanceTest(options) {}
+
+    /**
+     * @brief Create the data to encode.
+     *
+     */
+    void Setup() override
+    {
+      m_data.resize(m_options.GetOptionOrDefault<std::size_t>("Size", 32));
+      for (std::size_t i = 0; i < m_data.size(); ++i)
+      {
+        m_data[i] = static_cast<uint8_t>(i * 31 + 7);
+      }
+      m_useBuffers = m_options.GetOptionOrDefault<bool>("Buffers", false);
+      m_text.resize(Azure::Core::Base64EncodedLength(m_data.size()));
+      m_decoded.resize(Azure::Core::Base64DecodedMaxLength(m_text.size()));
+    }
+
+    /**
+     * @brief Encode and decode the data, either into new strings and vectors or into the buffers
+     * allocated by the setup.
+     *
+     * @param ctx The cancellation token.
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      if (m_useBuffers)
+      {
+        const std::size_t encodedLength
+            = Azure::Core::Base64Encode(m_data.data(), m_data.size(), &m_text[0]);
+        Azure::Core::Base64Decode(m_text.data(), encodedLength, m_decoded.data());
+      }
+      else
+      {
+        auto decoded = Azure::Core::Base64Decode(Azure::Core::Base64Encode(m_data));
+        (void)decoded;
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::PerformanceStress::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size"}, "The number of bytes to encode, 32 by default.", 1, false},
+          {"Buffers",
+           {"--buffers"},
+           "Encode and decode into preallocated buffers instead of new strings and vectors.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::PerformanceStress::TestMetadata describing the test.
+     */
+    static Azure::PerformanceStress::TestMetadata GetTestMetadata()
+    {
+      return {
+          "Base64Test",
+          "Measures encoding binary data to base 64 and decoding it back",
+          [](Azure::PerformanceStress::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::Performance::Base64Test>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Core::Test::Performance
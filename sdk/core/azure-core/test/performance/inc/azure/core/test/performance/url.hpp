@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of building and serializing a URL.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/http.hpp>
+#include <azure/performance_framework.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test { namespace Performance {
+
+  /**
+   * @brief Measure what a client does for each blob of a listing: encode the name, append it to
+   * the container URL, add query parameters and get the absolute URL.
+   *
+   */
+  class UrlTest : public Azure::PerformanceStress::PerformanceTest {
+  private:
+    Azure::Core::Http::Url m_containerUrl;
+    std::string m_blobName;
+
+  public:
+    /**
+     * @brief Construct a new Url test.
+     *
+     * @param options The test options.
+     */
+    UrlTest(Azure::PerformanceStress::TestOptions options) : PerformanceTest(options) {}
+
+    /**
+     * @brief Create the container URL and the blob name.
+     *
+     */
+    void Setup() override
+    {
+      m_containerUrl = Azure::Core::Http::Url("https://account.blob.core.windows.net/container");
+      m_blobName = m_options.GetOptionOrDefault<std::string>(
+          "Name", "logs/2021/02/18/part-00042 (copy).json");
+    }
+
+    /**
+     * @brief Build the blob URL and serialize it.
+     *
+     * @param ctx The cancellation token.
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      auto url = m_containerUrl;
+      url.AppendPath(Azure::Core::Http::Url::Encode(m_blobName, "/"));
+      url.AppendQueryParameter("comp", "block");
+      url.AppendQueryParameter("blockid", "MDAwMDAwMDAwMDAwMDAwMDAwMDAwMDAx");
+      auto absoluteUrl = url.GetAbsoluteUrl();
+      (void)absoluteUrl;
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::PerformanceStress::TestOption> GetTestOptions() override
+    {
+      return {{"Name", {"--name"}, "The blob name to encode into the URL.", 1, false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::PerformanceStress::TestMetadata describing the test.
+     */
+    static Azure::PerformanceStress::TestMetadata GetTestMetadata()
+    {
+      return {
+          "UrlTest",
+          "Measures building a blob URL and getting it as a string",
+          [](Azure::PerformanceStress::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::Performance::UrlTest>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Core::Test::Performance
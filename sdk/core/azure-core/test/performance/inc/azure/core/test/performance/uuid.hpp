@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of creating UUIDs.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/uuid.hpp>
+#include <azure/performance_framework.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test { namespace Performance {
+
+  /**
+   * @brief Measure creating a UUID and getting it as a string, as done for every request ID.
+   *
+   */
+  class UuidTest : public Azure::PerformanceStress::PerformanceTest {
+  private:
+    bool m_useRandomDevice = false;
+
+    // What Uuid::CreateUuid() and Uuid::ToString() used to do, to compare with.
+    static std::string CreateRandomDeviceUuidString()
+    {
+      std::random_device rd;
+      uint8_t uuid[16] = {};
+      for (int i = 0; i < 16; i += 4)
+      {
+        const uint32_t x = rd();
+        std::memcpy(uuid + i, &x, 4);
+      }
+      uuid[8] = (uuid[8] | 0x40) & 0x7F;
+      uuid[6] = (uuid[6] & 0xF) | (4 << 4);
+
+      char s[37];
+      std::snprintf(
+          s,
+          sizeof(s),
+          "%2.2x%2.2x%2.2x%2.2x-%2.2x%2.2x-%2.2x%2.2x-%2.2x%2.2x-%2.2x%2.2x%2.2x%2.2x%2.2x%2.2x",
+          uuid[0],
+          uuid[1],
+          uuid[2],
+          uuid[3],
+          uuid[4],
+          uuid[5],
+          uuid[6],
+          uuid[7],
+          uuid[8],
+          uuid[9],
+          uuid[10],
+          uuid[11],
+          uuid[12],
+          uuid[13],
+          uuid[14],
+          uuid[15]);
+      return std::string(s);
+    }
+
+  public:
+    /**
+     * @brief Construct a new Uuid test.
+     *
+     * @param options The test options.
+     */
+    UuidTest(Azure::PerformanceStress::TestOptions options) : PerformanceTest(options) {}
+
+    /**
+     * @brief Read the test options.
+     *
+     */
+    void Setup() override
+    {
+      m_useRandomDevice = m_options.GetOptionOrDefault<bool>("RandomDevice", false);
+    }
+
+    /**
+     * @brief Create a UUID string.
+     *
+     * @param ctx The cancellation token.
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      auto uuid = m_useRandomDevice ? CreateRandomDeviceUuidString()
+                                    : Azure::Core::Uuid::CreateUuid().ToString();
+      (void)uuid;
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::PerformanceStress::TestOption> GetTestOptions() override
+    {
+      return {
+          {"RandomDevice",
+           {"--random-device"},
+           "Draw every UUID from std::random_device and format it with snprintf, to compare with.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::PerformanceStress::TestMetadata describing the test.
+     */
+    static Azure::PerformanceStress::TestMetadata GetTestMetadata()
+    {
+      return {
+          "UuidTest",
+          "Measures creating a UUID and getting it as a string",
+          [](Azure::PerformanceStress::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::Performance::UuidTest>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Core::Test::Performance
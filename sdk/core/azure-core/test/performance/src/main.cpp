@@ -3,7 +3,10 @@
 
 #include <azure/performance_framework.hpp>
 
+#include "azure/core/test/performance/base64.hpp"
 #include "azure/core/test/performance/nullable.hpp"
+#include "azure/core/test/performance/url.hpp"
+#include "azure/core/test/performance/uuid.hpp"
 
 #include <vector>
 
@@ -12,7 +15,10 @@ int main(int argc, char** argv)
 
   // Create the test list
   std::vector<Azure::PerformanceStress::TestMetadata> tests{
-      Azure::Core::Test::Performance::NullableTest::GetTestMetadata()};
+      Azure::Core::Test::Performance::Base64Test::GetTestMetadata(),
+      Azure::Core::Test::Performance::NullableTest::GetTestMetadata(),
+      Azure::Core::Test::Performance::UrlTest::GetTestMetadata(),
+      Azure::Core::Test::Performance::UuidTest::GetTestMetadata()};
 
   Azure::PerformanceStress::Program::Run(Azure::Core::GetApplicationContext(), tests, argc, argv);
 
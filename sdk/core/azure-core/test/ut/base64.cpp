@@ -4,6 +4,7 @@
 #include <azure/core/base64.hpp>
 #include <gtest/gtest.h>
 #include <random>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -111,3 +112,32 @@ TEST(Base64, Roundtrip)
     EXPECT_EQ(Base64Decode(Base64Encode(data)), data);
   }
 }
+
+TEST(Base64, BufferOverloads)
+{
+  const std::vector<uint8_t> data = {0xfb, 0xff, 0x00, 0x10, 0x83};
+  for (std::size_t len = 0; len <= data.size(); ++len)
+  {
+    std::string encoded(Base64EncodedLength(len), '\0');
+    EXPECT_EQ(Base64Encode(data.data(), len, &encoded[0]), encoded.length());
+    EXPECT_EQ(encoded, Base64Encode(std::vector<uint8_t>(data.begin(), data.begin() + len)));
+
+    std::vector<uint8_t> decoded(Base64DecodedMaxLength(encoded.length()));
+    decoded.resize(Base64Decode(encoded.data(), encoded.length(), decoded.data()));
+    EXPECT_EQ(decoded, std::vector<uint8_t>(data.begin(), data.begin() + len));
+  }
+  EXPECT_EQ(Base64Encode(data.data(), data.size()), "+/8AEIM=");
+}
+
+TEST(Base64, Decode)
+{
+  // padding is optional
+  EXPECT_EQ(Base64Decode("AQ"), std::vector<uint8_t>({1}));
+  EXPECT_EQ(Base64Decode("AQI"), std::vector<uint8_t>({1, 2}));
+  EXPECT_EQ(Base64Decode("+/8AEIM"), std::vector<uint8_t>({0xfb, 0xff, 0x00, 0x10, 0x83}));
+
+  for (const std::string text : {"A", "AQIDB", "AQ=", "A===", "AQ==AQ==", "AQ I", "AQ-_", "AQ\n="})
+  {
+    EXPECT_THROW(Base64Decode(text), std::invalid_argument);
+  }
+}
@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 #include <azure/core/datetime.hpp>
+#include <azure/core/internal/date_time.hpp>
 
 #include <chrono>
 #include <limits>
@@ -759,3 +760,66 @@ TEST(DateTime, TimeRoundtrip)
   TestDateTimeRoundtrip<DateTime::TimeFractionFormat::AllDigits>("2021-02-05T10:00:00.0000000Z");
   TestDateTimeRoundtrip<DateTime::TimeFractionFormat::AllDigits>("2021-02-05T20:00:00.0000000Z");
 }
+
+TEST(DateTime, ParseCanonicalFormsMatchGeneralParser)
+{
+  // the first string of each pair takes the fixed width path, the second the general parser
+  EXPECT_EQ(
+      DateTime::Parse("Thu, 18 Feb 2021 08:03:09 GMT", DateTime::DateFormat::Rfc1123),
+      DateTime::Parse("18 Feb 2021 08:03:09 GMT", DateTime::DateFormat::Rfc1123));
+  EXPECT_EQ(
+      DateTime::Parse("Mon, 01 Jan 0001 00:00:00 GMT", DateTime::DateFormat::Rfc1123),
+      DateTime::Parse("1 Jan 0001 00:00 UT", DateTime::DateFormat::Rfc1123));
+  EXPECT_EQ(
+      DateTime::Parse("2021-02-18T08:03:09Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("20210218T080309", DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      DateTime::Parse("2021-02-18T08:03:09.12Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("2021-02-18T08:03:09.1200000+00:00", DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      DateTime::Parse("9999-12-31T23:59:59.9999999Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("9999-12-31T23:59:59.9999999-00:00", DateTime::DateFormat::Rfc3339));
+
+  // more fractional digits than the precision are rounded by the general parser
+  EXPECT_EQ(
+      DateTime::Parse("2021-02-18T08:03:09.12345678Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("2021-02-18T08:03:09.1234568Z", DateTime::DateFormat::Rfc3339));
+
+  EXPECT_THROW(
+      DateTime::Parse("Fri, 18 Feb 2021 08:03:09 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("Thu, 30 Feb 2021 08:03:09 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("Thu, 18 Feb 2021 24:03:09 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("2021-13-18T08:03:09Z", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("2021-02-18T08:0x:09Z", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+}
+
+TEST(DateTime, ToRfc1123StringCached)
+{
+  auto const dt = DateTime::Parse("2021-02-18T08:03:09Z", DateTime::DateFormat::Rfc3339);
+  EXPECT_EQ(Internal::ToRfc1123String(dt), "Thu, 18 Feb 2021 08:03:09 GMT");
+  // same second
+  EXPECT_EQ(
+      Internal::ToRfc1123String(dt + std::chrono::milliseconds(999)),
+      "Thu, 18 Feb 2021 08:03:09 GMT");
+  EXPECT_EQ(
+      Internal::ToRfc1123String(dt + std::chrono::seconds(1)), "Thu, 18 Feb 2021 08:03:10 GMT");
+  // going back in time
+  EXPECT_EQ(
+      Internal::ToRfc1123String(dt - std::chrono::hours(24)), "Wed, 17 Feb 2021 08:03:09 GMT");
+  EXPECT_EQ(Internal::ToRfc1123String(dt), "Thu, 18 Feb 2021 08:03:09 GMT");
+
+  auto const now = DateTime(std::chrono::system_clock::now());
+  EXPECT_EQ(Internal::ToRfc1123String(now), now.ToString(DateTime::DateFormat::Rfc1123));
+
+  EXPECT_THROW(
+      Internal::ToRfc1123String(DateTime() - std::chrono::milliseconds(1)), std::invalid_argument);
+}
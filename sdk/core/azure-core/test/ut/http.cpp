@@ -63,6 +63,23 @@ namespace Azure { namespace Core { namespace Test {
         expected2);
   }
 
+  // Request - Visit headers
+  TEST(TestHttp, for_each_header)
+  {
+    Http::Request req(Http::HttpMethod::Get, Http::Url("http://test.com"));
+    req.AddHeader("x-ms-version", "2020-02-10");
+    req.AddHeader("Content-Length", "0");
+    req.AddHeader("x-ms-date", "Thu, 18 Feb 2021 08:00:00 GMT");
+
+    std::vector<std::pair<std::string, std::string>> headers;
+    req.ForEachHeader([&headers](const std::string& name, const std::string& value) {
+      headers.emplace_back(name, value);
+    });
+    auto allHeaders = req.GetHeaders();
+    std::vector<std::pair<std::string, std::string>> expected(allHeaders.begin(), allHeaders.end());
+    EXPECT_EQ(headers, expected);
+  }
+
   // Response - Add header
   TEST(TestHttp, response_add_headers)
   {
@@ -2,8 +2,12 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/core/internal/json.hpp>
+#include <azure/core/internal/json_sax.hpp>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 using json = Azure::Core::Internal::Json::json;
 
 // Just a simple test to ensure that Azure Core internal is wrapping nlohmann json
@@ -15,3 +19,83 @@ TEST(Json, create)
 
   EXPECT_EQ(expected, j.dump());
 }
+
+namespace {
+// writes down every value with its path, e.g. "a.b=1"
+class RecordingSaxHandler : public Azure::Core::Internal::Json::JsonSaxHandler {
+public:
+  std::vector<std::string> Values;
+  int ItemCount = 0;
+
+private:
+  void Record(const std::string& value)
+  {
+    std::string path;
+    for (const auto& name : GetPath())
+    {
+      path += (path.empty() ? "" : ".") + name;
+    }
+    Values.push_back(path + "=" + value);
+  }
+
+  void OnStartObject() override
+  {
+    if (IsAt({"items"}))
+    {
+      ++ItemCount;
+    }
+  }
+  void OnString(std::string& value) override { Record("'" + value + "'"); }
+  void OnInteger(int64_t value) override { Record(std::to_string(value)); }
+  void OnFloat(double value) override { Record(std::to_string(value)); }
+  void OnBoolean(bool value) override { Record(value ? "true" : "false"); }
+  void OnNull() override { Record("null"); }
+};
+} // namespace
+
+TEST(Json, sax_handler)
+{
+  const std::string document = "{\"a\": {\"b\": 1, \"c\": [\"x\", -2, 0.5]}, \"d\": null,"
+                               " \"items\": [{\"name\": \"i\\u00e9\"}, {\"name\": true}, []]}";
+  RecordingSaxHandler handler;
+  handler.Parse(std::vector<uint8_t>(document.begin(), document.end()));
+  std::vector<std::string> expected{
+      "a.b=1",
+      "a.c='x'",
+      "a.c=-2",
+      "a.c=0.500000",
+      "d=null",
+      "items.name='i\xC3\xA9'",
+      "items.name=true"};
+  EXPECT_EQ(handler.Values, expected);
+  EXPECT_EQ(handler.ItemCount, 2);
+
+  const std::string truncated = "{\"a\": [1, 2";
+  EXPECT_THROW(
+      handler.Parse(reinterpret_cast<const uint8_t*>(truncated.data()), truncated.size()),
+      json::parse_error);
+}
+
+TEST(Json, sax_handler_malformed)
+{
+  const std::string document = "{\"a\": 1, \"b\": tru}";
+  RecordingSaxHandler handler;
+  try
+  {
+    handler.Parse(std::vector<uint8_t>(document.begin(), document.end()));
+    FAIL() << "Parse didn't throw";
+  }
+  catch (json::parse_error& e)
+  {
+    EXPECT_EQ(e.id, 101);
+    EXPECT_GT(e.byte, 0U);
+  }
+  // values before the error were still handed out
+  std::vector<std::string> expected{"a=1"};
+  EXPECT_EQ(handler.Values, expected);
+
+  // the handler can be reused after a failure
+  handler.Values.clear();
+  handler.Parse(std::vector<uint8_t>{'[', '2', ']'});
+  EXPECT_EQ(handler.Values, std::vector<std::string>{"=2"});
+}
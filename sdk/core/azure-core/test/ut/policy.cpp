@@ -3,8 +3,11 @@
 
 #include <azure/core/http/policy.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/response.hpp>
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace {
@@ -23,6 +26,25 @@ public:
     return nullptr;
   }
 };
+
+class BodyTransport : public Azure::Core::Http::HttpTransport {
+public:
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Context const&,
+      Azure::Core::Http::Request&) override
+  {
+    auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+        1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+    response->AddHeader("x-ms-request-id", "1");
+    response->SetBodyStream(
+        std::make_unique<Azure::Core::Http::MemoryBodyStream>(
+            reinterpret_cast<const uint8_t*>(m_body.data()), m_body.size()));
+    return response;
+  }
+
+private:
+  const std::string m_body = "<?xml version=\"1.0\"?><Value>42</Value>";
+};
 } // namespace
 
 TEST(Policy, throwWhenNoTransportPolicy)
@@ -88,3 +110,32 @@ TEST(Policy, ValuePolicy)
   ASSERT_EQ(headers, decltype(headers)({{"hdrkey1", "HdrVal1"}, {"hdrkey2", "HdrVal2"}}));
   ASSERT_EQ(queryParams, decltype(queryParams)({{"QryKey1", "QryVal1"}, {"QryKey2", "QryVal2"}}));
 }
+
+TEST(Policy, ReleaseBodyAfterDeserialization)
+{
+  using namespace Azure::Core;
+  using namespace Azure::Core::Http;
+  using namespace Azure::Core::Internal::Http;
+
+  for (bool release : {false, true})
+  {
+    TransportPolicyOptions options;
+    options.Transport = std::make_shared<BodyTransport>();
+    options.ReleaseBodyAfterDeserialization = release;
+    std::vector<std::unique_ptr<HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<TransportPolicy>(options));
+    HttpPipeline pipeline(policies);
+
+    Request request(HttpMethod::Get, Url("http://localhost"));
+    auto rawResponse = pipeline.Send(Azure::Core::Context(), request);
+    // the body is there to deserialize
+    ASSERT_EQ(rawResponse->GetBody().size(), 38U);
+
+    Response<int> response(42, std::move(rawResponse));
+    EXPECT_EQ(*response, 42);
+    EXPECT_EQ(response.GetRawResponse().GetBody().empty(), release);
+    EXPECT_EQ(response.GetRawResponse().GetBody().capacity() == 0, release);
+    EXPECT_EQ(response.GetRawResponse().GetHeaders().at("x-ms-request-id"), "1");
+    EXPECT_EQ(response.GetRawResponse().GetStatusCode(), HttpStatusCode::Ok);
+  }
+}
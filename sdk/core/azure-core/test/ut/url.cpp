@@ -5,6 +5,9 @@
 
 #include <azure/core/http/http.hpp>
 
+#include <cctype>
+#include <string>
+
 using namespace Azure::Core;
 
 namespace Azure { namespace Core { namespace Test {
@@ -147,6 +150,54 @@ namespace Azure { namespace Core { namespace Test {
         "http://test.com?query=va%3Dl%20u%3Fe");
   }
 
+  TEST(URL, encode_decode_all_characters)
+  {
+    std::string all;
+    for (int i = 0; i < 256; ++i)
+    {
+      all += static_cast<char>(i);
+    }
+    std::string encoded = Http::Url::Encode(all);
+    for (char c : encoded)
+    {
+      EXPECT_TRUE(std::isalnum(static_cast<unsigned char>(c)) || c == '%' || c == '-' || c == '.'
+                  || c == '_' || c == '~');
+    }
+    // 66 unreserved characters are kept, every other one takes three
+    EXPECT_EQ(encoded.size(), static_cast<std::size_t>(66 + (256 - 66) * 3));
+    EXPECT_EQ(Http::Url::Decode(encoded), all);
+
+    EXPECT_EQ(Http::Url::Encode("Az09-._~"), "Az09-._~");
+    EXPECT_EQ(Http::Url::Encode("a/b c\xff", "/"), "a/b%20c%FF");
+    EXPECT_EQ(Http::Url::Encode(""), "");
+
+    EXPECT_EQ(Http::Url::Decode("no-escapes"), "no-escapes");
+    EXPECT_EQ(Http::Url::Decode("a+b%2fc%2F%41"), "a b/c/A");
+    EXPECT_EQ(Http::Url::Decode("%FF"), "\xff");
+    EXPECT_EQ(Http::Url::Decode(""), "");
+    EXPECT_THROW(Http::Url::Decode("abc%"), std::runtime_error);
+    EXPECT_THROW(Http::Url::Decode("abc%4"), std::runtime_error);
+    EXPECT_THROW(Http::Url::Decode("abc%4g"), std::runtime_error);
+    EXPECT_THROW(Http::Url::Decode("%\xff\xff"), std::runtime_error);
+  }
+
+  TEST(URL, relative_and_absolute)
+  {
+    Http::Url url("https://account.blob.core.windows.net:8443/container/blob?b=2&a=1");
+    EXPECT_EQ(url.GetRelativeUrl(), "container/blob?a=1&b=2");
+    EXPECT_EQ(
+        url.GetAbsoluteUrl(), "https://account.blob.core.windows.net:8443/container/blob?a=1&b=2");
+
+    url.RemoveQueryParameter("a");
+    url.RemoveQueryParameter("b");
+    EXPECT_EQ(url.GetRelativeUrl(), "container/blob");
+    EXPECT_EQ(url.GetAbsoluteUrl(), "https://account.blob.core.windows.net:8443/container/blob");
+
+    Http::Url hostOnly("account.blob.core.windows.net?comp=list");
+    EXPECT_EQ(hostOnly.GetRelativeUrl(), "?comp=list");
+    EXPECT_EQ(hostOnly.GetAbsoluteUrl(), "account.blob.core.windows.net?comp=list");
+  }
+
   TEST(URL, add_path)
   {
     Http::HttpMethod httpMethod = Http::HttpMethod::Post;
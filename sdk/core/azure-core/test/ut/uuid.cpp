@@ -1,10 +1,14 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // SPDX-License-Identifier: MIT
 
+#include <azure/core/internal/cryptography/chacha20.hpp>
+#include <azure/core/internal/strings.hpp>
 #include <azure/core/uuid.hpp>
 #include <gtest/gtest.h>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace Azure::Core;
 
@@ -70,3 +74,65 @@ TEST(Uuid, validChars)
       uuidKey,
       4);
 }
+
+TEST(Uuid, Version4)
+{
+  for (int i = 0; i < 1000; i++)
+  {
+    auto uuidKey = Uuid::CreateUuid().ToString();
+    EXPECT_EQ(uuidKey[14], '4');
+    EXPECT_EQ(uuidKey, Azure::Core::Internal::Strings::ToLower(uuidKey));
+  }
+}
+
+TEST(Uuid, AcrossThreads)
+{
+  const int threadCount = 4;
+  const int size = 10000;
+  std::vector<std::vector<std::string>> results(threadCount);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; t++)
+  {
+    threads.emplace_back([&results, t]() {
+      for (int i = 0; i < size; i++)
+      {
+        results[t].push_back(Uuid::CreateUuid().ToString());
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::set<std::string> uuids;
+  for (const auto& result : results)
+  {
+    uuids.insert(result.begin(), result.end());
+  }
+  EXPECT_EQ(uuids.size(), static_cast<std::size_t>(threadCount * size));
+}
+
+TEST(Uuid, ChaCha20Block)
+{
+  // RFC 8439, appendix A.1, test vectors #1 and #2
+  uint32_t const key[8] = {};
+  std::vector<uint8_t> const expected0 = {
+      0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53,
+      0x86, 0xbd, 0x28, 0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a, 0xa8, 0x36,
+      0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7, 0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48,
+      0x8d, 0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37, 0x6a, 0x43, 0xb8, 0xf4,
+      0x15, 0x18, 0xa1, 0x1c, 0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86};
+  std::vector<uint8_t> const expected1 = {
+      0x9f, 0x07, 0xe7, 0xbe, 0x55, 0x51, 0x38, 0x7a, 0x98, 0xba, 0x97, 0x7c, 0x73,
+      0x2d, 0x08, 0x0d, 0xcb, 0x0f, 0x29, 0xa0, 0x48, 0xe3, 0x65, 0x69, 0x12, 0xc6,
+      0x53, 0x3e, 0x32, 0xee, 0x7a, 0xed, 0x29, 0xb7, 0x21, 0x76, 0x9c, 0xe6, 0x4e,
+      0x43, 0xd5, 0x71, 0x33, 0xb0, 0x74, 0xd8, 0x39, 0xd5, 0x31, 0xed, 0x1f, 0x28,
+      0x51, 0x0a, 0xfb, 0x45, 0xac, 0xe1, 0x0a, 0x1f, 0x4b, 0x79, 0x4d, 0x6f};
+
+  std::vector<uint8_t> block(64);
+  Azure::Core::Cryptography::Internal::ChaCha20Block(key, 0, block.data());
+  EXPECT_EQ(block, expected0);
+  Azure::Core::Cryptography::Internal::ChaCha20Block(key, 1, block.data());
+  EXPECT_EQ(block, expected1);
+}
@@ -5,12 +5,50 @@
 
 #include <azure/core/http/http.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/internal/json_sax.hpp>
 
 #include <chrono>
 #include <sstream>
+#include <string>
 
 using namespace Azure::Identity;
 
+namespace {
+// Reads the members of a token response the credential needs, ignoring everything else in it.
+class TokenResponseSaxHandler : public Azure::Core::Internal::Json::JsonSaxHandler {
+public:
+  std::string AccessToken;
+  long long ExpiresInSeconds = 0;
+  bool HasAccessToken = false;
+  bool HasExpiresIn = false;
+
+protected:
+  void OnString(std::string& value) override
+  {
+    if (IsAt({"access_token"}))
+    {
+      AccessToken = std::move(value);
+      HasAccessToken = true;
+    }
+    // some authorities send the lifetime as a string
+    else if (IsAt({"expires_in"}))
+    {
+      ExpiresInSeconds = std::stoll(value);
+      HasExpiresIn = true;
+    }
+  }
+
+  void OnInteger(int64_t value) override
+  {
+    if (IsAt({"expires_in"}))
+    {
+      ExpiresInSeconds = value;
+      HasExpiresIn = true;
+    }
+  }
+};
+} // namespace
+
 std::string const Azure::Identity::Details::g_aadGlobalAuthority
     = "https://login.microsoftonline.com/";
 
@@ -86,17 +124,13 @@ Azure::Core::AccessToken ClientSecretCredential::GetToken(
       throw AuthenticationException(errorMsg.str());
     }
 
-    auto const& responseBodyVector = response->GetBody();
-    std::string responseBody(responseBodyVector.begin(), responseBodyVector.end());
-
-    // TODO: use JSON parser.
-    auto const responseBodySize = responseBody.size();
-
     static std::string const jsonExpiresIn = "expires_in";
     static std::string const jsonAccessToken = "access_token";
 
-    auto responseBodyPos = responseBody.find(':', responseBody.find(jsonExpiresIn));
-    if (responseBodyPos == std::string::npos)
+    TokenResponseSaxHandler tokenResponse;
+    tokenResponse.Parse(response->GetBody());
+
+    if (!tokenResponse.HasExpiresIn)
     {
       std::ostringstream errorMsg;
       errorMsg << errorMsgPrefix << "response json: \'" << jsonExpiresIn << "\' not found.";
@@ -104,29 +138,7 @@ Azure::Core::AccessToken ClientSecretCredential::GetToken(
       throw AuthenticationException(errorMsg.str());
     }
 
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
-    {
-      auto c = responseBody[responseBodyPos];
-      if (c != ':' && c != ' ' && c != '\"' && c != '\'')
-      {
-        break;
-      }
-    }
-
-    long long expiresInSeconds = 0;
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
-    {
-      auto c = responseBody[responseBodyPos];
-      if (c < '0' || c > '9')
-      {
-        break;
-      }
-
-      expiresInSeconds = (expiresInSeconds * 10) + (static_cast<long long>(c) - '0');
-    }
-
-    responseBodyPos = responseBody.find(':', responseBody.find(jsonAccessToken));
-    if (responseBodyPos == std::string::npos)
+    if (!tokenResponse.HasAccessToken)
     {
       std::ostringstream errorMsg;
       errorMsg << errorMsgPrefix << "response json: \'" << jsonAccessToken << "\' not found.";
@@ -134,31 +146,9 @@ Azure::Core::AccessToken ClientSecretCredential::GetToken(
       throw AuthenticationException(errorMsg.str());
     }
 
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
-    {
-      auto c = responseBody[responseBodyPos];
-      if (c != ':' && c != ' ' && c != '\"' && c != '\'')
-      {
-        break;
-      }
-    }
-
-    auto const tokenBegin = responseBodyPos;
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
-    {
-      auto c = responseBody[responseBodyPos];
-      if (c == '\"' || c == '\'')
-      {
-        break;
-      }
-    }
-    auto const tokenEnd = responseBodyPos;
-
-    auto const responseBodyBegin = responseBody.begin();
-
     return {
-        std::string(responseBodyBegin + tokenBegin, responseBodyBegin + tokenEnd),
-        std::chrono::system_clock::now() + std::chrono::seconds(expiresInSeconds),
+        std::move(tokenResponse.AccessToken),
+        std::chrono::system_clock::now() + std::chrono::seconds(tokenResponse.ExpiresInSeconds),
     };
   }
   catch (AuthenticationException const&)
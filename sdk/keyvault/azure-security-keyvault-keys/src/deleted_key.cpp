@@ -4,33 +4,66 @@
 #include "azure/keyvault/keys/deleted_key.hpp"
 #include "azure/keyvault/keys/key_constants.hpp"
 #include "azure/keyvault/keys/key_vault_key.hpp"
+#include "key_vault_key_private.hpp"
 
 #include <azure/keyvault/common/internal/unix_time_helper.hpp>
 
-#include <azure/core/internal/json.hpp>
-
 using namespace Azure::Security::KeyVault::Keys;
 using Azure::Security::KeyVault::Common::Internal::UnixTimeConverter;
 
+namespace {
+class DeletedKeySaxHandler : public Details::KeyVaultKeySaxHandler {
+public:
+  explicit DeletedKeySaxHandler(DeletedKey& deletedKey)
+      : KeyVaultKeySaxHandler(deletedKey), m_deletedKey(deletedKey)
+  {
+  }
+
+protected:
+  void OnString(std::string& value) override
+  {
+    // recoveryId
+    if (IsAt({Details::RecoveryIdPropertyName}))
+    {
+      m_deletedKey.RecoveryId = std::move(value);
+    }
+    else
+    {
+      KeyVaultKeySaxHandler::OnString(value);
+    }
+  }
+
+  void OnInteger(int64_t value) override
+  {
+    // deletedDate
+    // scheduledPurgeDate
+    if (IsAt({Details::DeletedOnPropertyName}))
+    {
+      m_deletedKey.DeletedDate
+          = UnixTimeConverter::UnixTimeToDatetime(static_cast<uint64_t>(value));
+    }
+    else if (IsAt({Details::ScheduledPurgeDatePropertyName}))
+    {
+      m_deletedKey.ScheduledPurgeDate
+          = UnixTimeConverter::UnixTimeToDatetime(static_cast<uint64_t>(value));
+    }
+    else
+    {
+      KeyVaultKeySaxHandler::OnInteger(value);
+    }
+  }
+
+private:
+  DeletedKey& m_deletedKey;
+};
+} // namespace
+
 DeletedKey Details::DeletedKeyDeserialize(
     std::string const& name,
     Azure::Core::Http::RawResponse const& rawResponse)
 {
-  auto body = rawResponse.GetBody();
-  auto jsonParser = Azure::Core::Internal::Json::json::parse(body);
-
-  // "Key"
+  // "Key" and the members a deleted key adds to it, in a single pass over the body
   DeletedKey deletedKey(name);
-  Details::KeyVaultKeyDeserialize(deletedKey, rawResponse);
-
-  // recoveryId
-  // deletedDate
-  // scheduledPurgeDate
-  deletedKey.RecoveryId = jsonParser[Details::RecoveryIdPropertyName].get<std::string>();
-  deletedKey.DeletedDate = UnixTimeConverter::UnixTimeToDatetime(
-      jsonParser[Details::DeletedOnPropertyName].get<uint64_t>());
-  deletedKey.ScheduledPurgeDate = UnixTimeConverter::UnixTimeToDatetime(
-      jsonParser[Details::ScheduledPurgeDatePropertyName].get<uint64_t>());
-
+  DeletedKeySaxHandler(deletedKey).Deserialize(rawResponse);
   return deletedKey;
 }
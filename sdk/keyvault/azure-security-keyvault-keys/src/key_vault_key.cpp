@@ -3,26 +3,13 @@
 
 #include "azure/keyvault/keys/key_vault_key.hpp"
 #include "azure/keyvault/keys/key_constants.hpp"
+#include "key_vault_key_private.hpp"
 
 #include <azure/keyvault/common/internal/unix_time_helper.hpp>
 
-#include <azure/core/internal/json.hpp>
-
 using namespace Azure::Security::KeyVault::Keys;
 using Azure::Security::KeyVault::Common::Internal::UnixTimeConverter;
 
-namespace {
-void ParseStringOperationsToKeyOperations(
-    std::vector<KeyOperation>& keyOperations,
-    std::vector<std::string> const& stringOperations)
-{
-  for (std::string const& operation : stringOperations)
-  {
-    keyOperations.emplace_back(KeyOperation(operation));
-  }
-}
-} // namespace
-
 KeyVaultKey Details::KeyVaultKeyDeserialize(
     std::string const& name,
     Azure::Core::Http::RawResponse const& rawResponse)
@@ -36,35 +23,44 @@ void Details::KeyVaultKeyDeserialize(
     KeyVaultKey& key,
     Azure::Core::Http::RawResponse const& rawResponse)
 {
-  auto body = rawResponse.GetBody();
-  auto jsonParser = Azure::Core::Internal::Json::json::parse(body);
+  KeyVaultKeySaxHandler(key).Deserialize(rawResponse);
+}
 
+void Details::KeyVaultKeySaxHandler::Deserialize(Azure::Core::Http::RawResponse const& rawResponse)
+{
+  m_keyOperations.clear();
+  Parse(rawResponse.GetBody());
+  m_key.Key.SetKeyOperations(m_keyOperations);
+}
+
+void Details::KeyVaultKeySaxHandler::OnString(std::string& value)
+{
   // "Key"
-  auto const& jsonKey = jsonParser[Details::KeyPropertyName];
+  if (IsAt({Details::KeyPropertyName, Details::KeyOpsPropertyName}))
   {
-    // key_ops
-    auto keyOperationVector = jsonKey[Details::KeyOpsPropertyName].get<std::vector<std::string>>();
-    std::vector<KeyOperation> keyOperations;
-    ParseStringOperationsToKeyOperations(keyOperations, keyOperationVector);
-    key.Key.SetKeyOperations(keyOperations);
+    m_keyOperations.emplace_back(KeyOperation(value));
   }
-  key.Key.Id = jsonKey[Details::KeyIdPropertyName].get<std::string>();
-  key.Key.KeyType
-      = Details::KeyTypeFromString(jsonKey[Details::KeyTypePropertyName].get<std::string>());
-
-  // "Attributes"
+  else if (IsAt({Details::KeyPropertyName, Details::KeyIdPropertyName}))
   {
-    auto attributes = jsonParser[Details::AttributesPropertyName];
-    key.Properties.CreatedOn
-        = UnixTimeConverter::UnixTimeToDatetime(attributes["created"].get<uint64_t>());
+    m_key.Key.Id = std::move(value);
+  }
+  else if (IsAt({Details::KeyPropertyName, Details::KeyTypePropertyName}))
+  {
+    m_key.Key.KeyType = Details::KeyTypeFromString(value);
   }
-
   // "Tags"
-  auto const& tags = jsonParser[Details::TagsPropertyName];
+  else if (GetPath().size() == 2 && GetPath()[0] == Details::TagsPropertyName)
+  {
+    m_key.Properties.Tags.emplace(GetPath()[1], std::move(value));
+  }
+}
+
+void Details::KeyVaultKeySaxHandler::OnInteger(int64_t value)
+{
+  // "Attributes"
+  if (IsAt({Details::AttributesPropertyName, "created"}))
   {
-    for (auto tag = tags.begin(); tag != tags.end(); ++tag)
-    {
-      key.Properties.Tags.emplace(tag.key(), tag.value().get<std::string>());
-    }
+    m_key.Properties.CreatedOn
+        = UnixTimeConverter::UnixTimeToDatetime(static_cast<uint64_t>(value));
   }
 }
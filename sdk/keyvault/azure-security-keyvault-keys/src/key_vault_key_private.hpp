@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Deserializes the key bundle returned by Key Vault.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/keys/key_vault_key.hpp"
+
+#include <azure/core/http/http.hpp>
+#include <azure/core/internal/json_sax.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Keys { namespace Details {
+
+  /**
+   * @brief Fills a #KeyVaultKey while its JSON is parsed.
+   *
+   * @remark Models that extend the key bundle, such as #DeletedKey, derive from it to read
+   * their own members in the same pass.
+   */
+  class KeyVaultKeySaxHandler : public Azure::Core::Internal::Json::JsonSaxHandler {
+  public:
+    explicit KeyVaultKeySaxHandler(KeyVaultKey& key) : m_key(key) {}
+
+    /**
+     * @brief Parses the body of a response into the key.
+     */
+    void Deserialize(Azure::Core::Http::RawResponse const& rawResponse);
+
+  protected:
+    void OnString(std::string& value) override;
+    void OnInteger(int64_t value) override;
+
+  private:
+    KeyVaultKey& m_key;
+    std::vector<KeyOperation> m_keyOperations;
+  };
+
+}}}}} // namespace Azure::Security::KeyVault::Keys::Details
@@ -3,11 +3,15 @@
 
 #include "gtest/gtest.h"
 
+#include "mocked_transport_adapter_test.hpp"
+
 #include <azure/core/context.hpp>
 #include <azure/identity/client_secret_credential.hpp>
 #include <azure/keyvault/key_vault.hpp>
 
+#include <cstring>
 #include <memory>
+#include <string>
 
 using namespace Azure::Security::KeyVault::Keys;
 
@@ -24,3 +28,56 @@ TEST(KeyClient, initClient)
     EXPECT_NO_THROW(KeyClient keyClient("vaultUrl", credential));
   }
 }
+
+namespace {
+Azure::Core::Http::RawResponse FakeResponse(std::string const& body)
+{
+  Azure::Core::Http::RawResponse response(1, 1, Azure::Core::Http::HttpStatusCode::Ok, "Ok");
+  response.SetBody(std::vector<uint8_t>(body.begin(), body.end()));
+  return response;
+}
+} // namespace
+
+TEST(KeyVaultKey, Deserialize)
+{
+  auto response = FakeResponse(Azure::Security::KeyVault::Keys::Test::Details::FakeKey);
+  auto key = Details::KeyVaultKeyDeserialize("CreateSoftKeyTest", response);
+
+  EXPECT_EQ(key.Name(), "CreateSoftKeyTest");
+  EXPECT_EQ(
+      key.Key.Id,
+      "https://myvault.vault.azure.net/keys/CreateSoftKeyTest/78deebed173b48e48f55abf87ed4cf71");
+  EXPECT_EQ(key.GetKeyType(), KeyTypeEnum::Rsa);
+  ASSERT_EQ(key.KeyOperations().size(), 6U);
+  EXPECT_EQ(key.KeyOperations()[0].ToString(), "encrypt");
+  EXPECT_EQ(key.KeyOperations()[5].ToString(), "unwrapKey");
+  EXPECT_EQ(
+      key.Properties.CreatedOn.GetValue(),
+      Azure::Core::DateTime::Parse(
+          "2017-05-05T00:00:51Z", Azure::Core::DateTime::DateFormat::Rfc3339));
+  ASSERT_EQ(key.Properties.Tags.size(), 2U);
+  EXPECT_EQ(key.Properties.Tags["purpose"], "unit test");
+  EXPECT_EQ(key.Properties.Tags["test name "], "CreateGetDeleteKeyTest");
+}
+
+TEST(DeletedKey, Deserialize)
+{
+  std::string body(Azure::Security::KeyVault::Keys::Test::Details::FakeKey);
+  body.pop_back();
+  body += ", \"recoveryId\": \"https://myvault.vault.azure.net/deletedkeys/CreateSoftKeyTest\", "
+          "\"deletedDate\": 1493942452, \"scheduledPurgeDate\": 1501718452}";
+  auto response = FakeResponse(body);
+  auto key = Details::DeletedKeyDeserialize("CreateSoftKeyTest", response);
+
+  EXPECT_EQ(key.RecoveryId, "https://myvault.vault.azure.net/deletedkeys/CreateSoftKeyTest");
+  EXPECT_EQ(
+      key.DeletedDate,
+      Azure::Core::DateTime::Parse(
+          "2017-05-05T00:00:52Z", Azure::Core::DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      key.ScheduledPurgeDate,
+      Azure::Core::DateTime::Parse(
+          "2017-08-03T00:00:52Z", Azure::Core::DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(key.GetKeyType(), KeyTypeEnum::Rsa);
+  EXPECT_EQ(key.Properties.Tags.size(), 2U);
+}
@@ -10,8 +10,10 @@
 
 #include <azure/core/credentials.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_result.hpp>
 
 #include "azure/storage/blobs/blob_options.hpp"
+#include "azure/storage/blobs/blob_random_access_reader.hpp"
 #include "azure/storage/blobs/blob_responses.hpp"
 #include "azure/storage/blobs/protocol/blob_rest_client.hpp"
 
@@ -154,6 +156,18 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetBlobPropertiesOptions& options = GetBlobPropertiesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Returns the properties of the blob like GetProperties, but doesn't throw if the
+     * service fails the request, for example because the blob doesn't exist.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A StorageResult with the blob's properties, or the error of the service.
+     */
+    StorageResult<Models::GetBlobPropertiesResult> TryGetProperties(
+        const GetBlobPropertiesOptions& options = GetBlobPropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Sets system properties on the blob.
      *
@@ -271,6 +285,49 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DownloadBlobToOptions& options = DownloadBlobToOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Opens a stream that reads a blob or a blob range sequentially. Upcoming chunks are
+     * downloaded ahead of the reader using parallel requests, all pinned to the ETag the blob had
+     * when the stream was opened.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations, including the requests made
+     * while reading from the stream.
+     * @return A stream with the content of the blob or blob range.
+     */
+    std::unique_ptr<Azure::Core::Http::BodyStream> OpenRead(
+        const OpenReadBlobOptions& options = OpenReadBlobOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Opens a reader for random access to the blob, e.g. for columnar file formats that
+     * read a footer first and then scattered column chunks.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A BlobRandomAccessReader for the current version of the blob.
+     */
+    BlobRandomAccessReader OpenRandomAccessReader(
+        const OpenBlobRandomAccessReaderOptions& options = OpenBlobRandomAccessReaderOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Downloads a set of blob ranges into the buffers provided. Adjacent ranges are
+     * downloaded together, large ones are split, and the requests run in parallel. Every request
+     * is pinned to the ETag of the first response, or to the one in the access conditions if
+     * specified, and retries on its own.
+     *
+     * @param ranges The ranges to download. Ranges may be in any order and may overlap, at least
+     * one of them must not be empty. All ranges must lie within the blob.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DownloadBlobRangesResult describing the downloaded blob.
+     */
+    Azure::Core::Response<Models::DownloadBlobRangesResult> DownloadRanges(
+        const std::vector<BlobRangeBuffer>& ranges,
+        const DownloadBlobRangesOptions& options = DownloadBlobRangesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a read-only snapshot of a blob.
      *
@@ -295,6 +352,18 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DeleteBlobOptions& options = DeleteBlobOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Marks the specified blob or snapshot for deletion like Delete, but doesn't throw if
+     * the service fails the request.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A StorageResult with a DeleteBlobResult, or the error of the service.
+     */
+    StorageResult<Models::DeleteBlobResult> TryDelete(
+        const DeleteBlobOptions& options = DeleteBlobOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Marks the specified blob or snapshot for deletion if it exists.
      *
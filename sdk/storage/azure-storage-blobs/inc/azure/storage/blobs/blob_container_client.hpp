@@ -4,9 +4,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
+#include <azure/storage/common/storage_pager.hpp>
+
 #include "azure/storage/blobs/blob_client.hpp"
 
 namespace Azure { namespace Storage { namespace Blobs {
@@ -135,6 +138,18 @@ namespace Azure { namespace Storage { namespace Blobs {
         const CreateBlobContainerOptions& options = CreateBlobContainerOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates a new container like Create, but doesn't throw if the service fails the
+     * request, for example because the container already exists.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A StorageResult with a CreateBlobContainerResult, or the error of the service.
+     */
+    StorageResult<Models::CreateBlobContainerResult> TryCreate(
+        const CreateBlobContainerOptions& options = CreateBlobContainerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new container under the specified account. If the container with the
      * same name already exists, it is not changed.
@@ -161,6 +176,18 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DeleteBlobContainerOptions& options = DeleteBlobContainerOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Marks the specified container for deletion like Delete, but doesn't throw if the
+     * service fails the request, for example because the container doesn't exist.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A StorageResult with a DeleteBlobContainerResult, or the error of the service.
+     */
+    StorageResult<Models::DeleteBlobContainerResult> TryDelete(
+        const DeleteBlobContainerOptions& options = DeleteBlobContainerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Marks the specified container for deletion if it exists. The container and any blobs
      * contained within it are later deleted during garbage collection.
@@ -186,6 +213,18 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetBlobContainerPropertiesOptions& options = GetBlobContainerPropertiesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Returns the properties of the container like GetProperties, but doesn't throw if the
+     * service fails the request, for example because the container doesn't exist.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A StorageResult with the container's properties, or the error of the service.
+     */
+    StorageResult<Models::GetBlobContainerPropertiesResult> TryGetProperties(
+        const GetBlobContainerPropertiesOptions& options = GetBlobContainerPropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Sets one or more user-defined name-value pairs for the specified container.
      *
@@ -213,6 +252,40 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobsSinglePageOptions& options = ListBlobsSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the blobs in this container a page at a time. The pages after the one
+     * being consumed are fetched in the background.
+     *
+     * @remark If OnBlobItem is set in the options, it's called on the thread fetching the page.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListBlobsSinglePageResult pages.
+     */
+    Pager<Models::ListBlobsSinglePageResult> ListBlobs(
+        const ListBlobsSinglePageOptions& options = ListBlobsSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Returns the same segment of blobs as ListBlobsSinglePage, in a compact form meant
+     * for enumerating containers with many blobs.
+     *
+     * @remark OnBlobItem in the options isn't used. The page is parsed while the response is
+     * being received; a failure after the response headers have arrived isn't retried.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A ListBlobsCompactSinglePageResult describing a segment of the blobs in the
+     * container.
+     */
+    Azure::Core::Response<Models::ListBlobsCompactSinglePageResult> ListBlobsCompactSinglePage(
+        const ListBlobsSinglePageOptions& options = ListBlobsSinglePageOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Returns a single segment of blobs in this container, starting from the
      * specified Marker, Use an empty Marker to start enumeration from the beginning and the
@@ -234,6 +307,39 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobsSinglePageOptions& options = ListBlobsSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the blobs and blob prefixes in this container a page at a time. The
+     * pages after the one being consumed are fetched in the background.
+     *
+     * @param delimiter This can be used to to traverse a virtual hierarchy of blobs as though it
+     * were a file system.
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListBlobsByHierarchySinglePageResult pages.
+     */
+    Pager<Models::ListBlobsByHierarchySinglePageResult> ListBlobsByHierarchy(
+        const std::string& delimiter,
+        const ListBlobsSinglePageOptions& options = ListBlobsSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Lists the blobs in this container with several requests in flight. The names are
+     * split into disjoint prefixes, given in the options or discovered as virtual directories,
+     * and the prefixes are listed concurrently.
+     *
+     * @param onBlobItem Called on the calling thread for each blob, one blob at a time.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     */
+    void ListBlobsParallel(
+        const std::function<void(Models::BlobItem)>& onBlobItem,
+        const ListBlobsParallelOptions& options = ListBlobsParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Gets the permissions for this container. The permissions indicate whether
      * container data may be accessed publicly.
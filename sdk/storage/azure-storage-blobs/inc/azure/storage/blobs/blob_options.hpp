@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -359,6 +360,63 @@ namespace Azure { namespace Storage { namespace Blobs {
      * @brief Specifies one or more datasets to include in the response.
      */
     Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
+
+    /**
+     * @brief If set, each blob is passed to this function as soon as it has been parsed instead of
+     * being added to the Items of the result. The response body is then parsed while it's being
+     * received, so only a small part of it is held in memory at a time.
+     *
+     * @remark A connection failure after the response headers have been received isn't retried in
+     * this mode, since blobs may already have been handed out.
+     */
+    std::function<void(Models::BlobItem)> OnBlobItem;
+  };
+
+  /**
+   * @brief Optional parameters for BlobContainerClient::ListBlobsParallel.
+   */
+  struct ListBlobsParallelOptions
+  {
+    /**
+     * @brief Lists only the blobs whose names begin with one of these prefixes, each of them
+     * listed separately. The prefixes mustn't overlap. All blobs are listed if empty.
+     */
+    std::vector<std::string> Prefixes;
+
+    /**
+     * @brief The delimiter used to discover the virtual directories under each prefix, which are
+     * then listed separately. No directories are discovered if empty.
+     */
+    std::string Delimiter = "/";
+
+    /**
+     * @brief The number of directory levels under each prefix that are discovered. The
+     * directories at the last level are listed flat.
+     */
+    int SplitDepth = 1;
+
+    /**
+     * @brief Hands out the blobs ordered by name, as a single listing would. Otherwise they are
+     * handed out as soon as their page arrives.
+     *
+     * @remark Pages that arrive ahead of their turn are held in memory.
+     */
+    bool Ordered = false;
+
+    /**
+     * @brief The maximum number of list requests in flight.
+     */
+    int Concurrency = 8;
+
+    /**
+     * @brief Specifies the maximum number of blobs to return in a single page.
+     */
+    Azure::Core::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief Specifies one or more datasets to include in the response.
+     */
+    Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
   };
 
   /**
@@ -526,6 +584,21 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Core::Nullable<Core::Http::Range> Range;
 
+    /**
+     * @brief Size of the blob, if already known, e.g. from BlobItem or GetProperties. All chunks
+     * are then downloaded in parallel right away instead of after the initial request. If the
+     * blob turns out to have a different size or changes during the download, the download starts
+     * over as if no size was given.
+     */
+    Azure::Core::Nullable<int64_t> BlobSizeHint;
+
+    /**
+     * @brief When specified, every chunk is requested along with its hash, which is checked while
+     * the chunk is written. A chunk that doesn't match is downloaded again. Since the service only
+     * returns the hash of ranges up to 4 MiB, InitialChunkSize and ChunkSize are limited to 4 MiB.
+     */
+    Azure::Core::Nullable<HashAlgorithm> TransactionalHashAlgorithm;
+
     struct
     {
       /**
@@ -544,6 +617,132 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int Concurrency = 5;
+
+      /**
+       * @brief If greater than 1 and the size of the blob isn't known, the download starts with
+       * this many requests of size ChunkSize at once instead of a single request of size
+       * InitialChunkSize. Requests past the end of the blob are discarded.
+       */
+      int SpeculativeRequestCount = 0;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for BlobClient::OpenRead.
+   */
+  struct OpenReadBlobOptions
+  {
+    /**
+     * @brief Reads only the bytes of the blob in the specified range.
+     */
+    Azure::Core::Nullable<Core::Http::Range> Range;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+
+    struct
+    {
+      /**
+       * @brief The maximum number of bytes in a single request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of bytes downloaded ahead of the reader. Up to WindowSize /
+       * ChunkSize requests run in parallel.
+       */
+      int64_t WindowSize = 32 * 1024 * 1024;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for BlobClient::OpenRandomAccessReader.
+   */
+  struct OpenBlobRandomAccessReaderOptions
+  {
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+
+    struct
+    {
+      /**
+       * @brief The size of a cached block. Reads are rounded up to whole blocks.
+       */
+      int64_t BlockSize = 1 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of bytes kept in the cache. Least recently used blocks are
+       * evicted first.
+       */
+      int64_t CacheSize = 64 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of bytes in a single request. Adjacent missing blocks are
+       * downloaded together up to this limit.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used by a single read or prefetch.
+       */
+      int Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief A range of a blob to download with BlobClient::DownloadRanges and the buffer that
+   * receives it.
+   */
+  struct BlobRangeBuffer
+  {
+    /**
+     * @brief Offset of the range in the blob.
+     */
+    int64_t Offset = 0;
+
+    /**
+     * @brief Length of the range.
+     */
+    int64_t Length = 0;
+
+    /**
+     * @brief Buffer of at least Length bytes that receives the range.
+     */
+    uint8_t* Buffer = nullptr;
+  };
+
+  /**
+   * @brief Optional parameters for BlobClient::DownloadRanges.
+   */
+  struct DownloadBlobRangesOptions
+  {
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+
+    struct
+    {
+      /**
+       * @brief Ranges that are at most this many bytes apart are downloaded with a single
+       * request, the bytes in between are discarded. Adjacent and overlapping ranges are always
+       * downloaded together.
+       */
+      int64_t MergeGapSize = 0;
+
+      /**
+       * @brief The maximum number of bytes in a single request. Larger ranges are split.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int Concurrency = 5;
     } TransferOptions;
   };
 
@@ -730,6 +929,15 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Core::Nullable<Models::AccessTier> Tier;
 
+    /**
+     * @brief When specified, the hash of every request's content is computed with this algorithm
+     * and sent along for the service to verify. For CRC64, the hash of the whole blob is combined
+     * from the hashes of its blocks and returned as the TransactionalContentHash of the result.
+     * @remark When uploading a file, the content of each request is read into memory, so up to
+     * ChunkSize * Concurrency bytes of memory are used, or the file size for a single upload.
+     */
+    Azure::Core::Nullable<HashAlgorithm> TransactionalHashAlgorithm;
+
     struct
     {
       /**
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <azure/core/context.hpp>
+#include <azure/core/etag.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/storage/common/block_cache_reader.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  class BlobClient;
+
+  /**
+   * @brief Reads arbitrary ranges of a blob through an LRU cache of fixed-size blocks. Missing
+   * blocks next to each other are downloaded with a single request and the requests of one read
+   * run in parallel. All requests are pinned to the ETag the blob had when the reader was opened,
+   * reads fail once the blob has changed. A reader can be used from multiple threads, copies
+   * share the same cache.
+   */
+  class BlobRandomAccessReader {
+  public:
+    /**
+     * @brief Gets the size of the blob.
+     *
+     * @return The size of the blob in bytes.
+     */
+    int64_t GetBlobSize() const { return m_reader->GetSize(); }
+
+    /**
+     * @brief Gets the ETag of the blob version being read.
+     *
+     * @return The ETag of the blob.
+     */
+    const Azure::Core::ETag& GetETag() const { return m_eTag; }
+
+    /**
+     * @brief Reads up to count bytes of the blob starting at offset.
+     *
+     * @param offset Offset in the blob to read from.
+     * @param buffer A memory buffer to write the blob content to.
+     * @param count The number of bytes to read.
+     * @param context Context for cancelling long running operations.
+     * @return The number of bytes read, less than count only at the end of the blob.
+     */
+    int64_t ReadAt(
+        int64_t offset,
+        uint8_t* buffer,
+        int64_t count,
+        const Azure::Core::Context& context = Azure::Core::Context()) const
+    {
+      return m_reader->ReadAt(offset, buffer, count, context);
+    }
+
+    /**
+     * @brief Starts downloading the given ranges into the cache in the background, e.g. the
+     * column chunks that are about to be read. Ranges close to each other are downloaded together.
+     *
+     * @param ranges The ranges of the blob to prefetch.
+     */
+    void Prefetch(const std::vector<Azure::Core::Http::Range>& ranges) const
+    {
+      std::vector<std::pair<int64_t, int64_t>> blockRanges;
+      for (const auto& range : ranges)
+      {
+        blockRanges.emplace_back(
+            range.Offset,
+            range.Length.HasValue() ? range.Length.GetValue() : GetBlobSize() - range.Offset);
+      }
+      m_reader->Prefetch(blockRanges);
+    }
+
+  private:
+    explicit BlobRandomAccessReader(
+        std::shared_ptr<Storage::Details::BlockCacheReader> reader,
+        Azure::Core::ETag eTag)
+        : m_reader(std::move(reader)), m_eTag(std::move(eTag))
+    {
+    }
+
+    std::shared_ptr<Storage::Details::BlockCacheReader> m_reader;
+    Azure::Core::ETag m_eTag;
+
+    friend class BlobClient;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -28,6 +28,13 @@ namespace Azure { namespace Storage { namespace Blobs {
       DownloadBlobDetails Details;
     };
 
+    struct DownloadBlobRangesResult
+    {
+      Models::BlobType BlobType;
+      int64_t BlobSize = 0;
+      DownloadBlobDetails Details;
+    };
+
     using UploadBlockBlobFromResult = UploadBlockBlobResult;
 
     struct AcquireBlobLeaseResult
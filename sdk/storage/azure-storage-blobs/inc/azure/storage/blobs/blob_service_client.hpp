@@ -8,6 +8,7 @@
 
 #include <azure/core/credentials.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
 
 #include "azure/storage/blobs/blob_container_client.hpp"
 
@@ -101,6 +102,22 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobContainersSinglePageOptions& options = ListBlobContainersSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the blob containers in this account a page at a time. The pages after
+     * the one being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListBlobContainersSinglePageResult pages.
+     */
+    Pager<Models::ListBlobContainersSinglePageResult> ListBlobContainers(
+        const ListBlobContainersSinglePageOptions& options = ListBlobContainersSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Retrieves a key that can be used to delegate Active Directory authorization to
      * shared access signatures.
@@ -188,6 +205,25 @@ namespace Azure { namespace Storage { namespace Blobs {
         const FindBlobsByTagsSinglePageOptions& options = FindBlobsByTagsSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the blobs whose tags match an expression a page at a time. The pages
+     * after the one being consumed are fetched in the background.
+     *
+     * @param tagFilterSqlExpression The where parameter enables the caller to query blobs whose
+     * tags match a given expression.
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over FindBlobsByTagsSinglePageResult pages.
+     */
+    Pager<Models::FindBlobsByTagsSinglePageResult> FindBlobsByTags(
+        const std::string& tagFilterSqlExpression,
+        const FindBlobsByTagsSinglePageOptions& options = FindBlobsByTagsSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new blob container under the specified account. If the container with the
      * same name already exists, the operation fails.
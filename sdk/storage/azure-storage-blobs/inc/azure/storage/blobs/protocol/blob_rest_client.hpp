@@ -4,12 +4,14 @@
 #pragma once
 
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <map>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <azure/core/context.hpp>
@@ -31,6 +33,7 @@ namespace Azure { namespace Storage { namespace Blobs {
 
   namespace Details {
     constexpr static const char* ApiVersion = "2020-02-10";
+    class BlobRestClient;
   } // namespace Details
 
   namespace Models {
@@ -1157,6 +1160,146 @@ namespace Azure { namespace Storage { namespace Blobs {
       std::vector<BlobItem> Items;
     }; // struct ListBlobsSinglePageResult
 
+    /**
+     * @brief The blobs of a listing page, stored column by column so that enumerating a large
+     * container takes a fraction of the memory a BlobItem per blob would.
+     *
+     * @remark Names, sizes, timestamps and ETags are kept for every blob. The other properties
+     * are usually the same for most blobs of a page; each distinct combination is kept once and
+     * decoded by GetBlobItem.
+     */
+    class CompactBlobItemList {
+    public:
+      /**
+       * @brief Returns the number of blobs in the list.
+       */
+      std::size_t Size() const noexcept { return m_blobSizes.size(); }
+
+      /**
+       * @brief Returns the name of a blob.
+       */
+      std::string GetName(std::size_t index) const { return m_names.Get(index); }
+
+      /**
+       * @brief Returns the size of a blob, in bytes.
+       */
+      int64_t GetBlobSize(std::size_t index) const { return m_blobSizes[index]; }
+
+      /**
+       * @brief Returns the time a blob was last modified.
+       */
+      Azure::Core::DateTime GetLastModified(std::size_t index) const
+      {
+        return m_lastModified[index];
+      }
+
+      /**
+       * @brief Returns the time a blob was created.
+       */
+      Azure::Core::DateTime GetCreatedOn(std::size_t index) const { return m_createdOn[index]; }
+
+      /**
+       * @brief Returns the ETag of a blob.
+       */
+      Azure::Core::ETag GetETag(std::size_t index) const
+      {
+        return Azure::Core::ETag(m_eTags.Get(index));
+      }
+
+      /**
+       * @brief Returns whether a blob is soft deleted.
+       */
+      bool IsDeleted(std::size_t index) const { return (m_flags[index] & DeletedFlag) != 0; }
+
+      /**
+       * @brief Returns the snapshot of a blob, or an empty string for a base blob.
+       */
+      std::string GetSnapshot(std::size_t index) const { return m_snapshots.Get(index); }
+
+      /**
+       * @brief Returns the version of a blob, if versions were listed.
+       */
+      Azure::Core::Nullable<std::string> GetVersionId(std::size_t index) const
+      {
+        if ((m_flags[index] & HasVersionIdFlag) == 0)
+        {
+          return Azure::Core::Nullable<std::string>();
+        }
+        return m_versionIds.Get(index);
+      }
+
+      /**
+       * @brief Decodes all the properties of a blob, the same as
+       * BlobContainerClient::ListBlobsSinglePage would have returned them.
+       */
+      BlobItem GetBlobItem(std::size_t index) const;
+
+    private:
+      // strings stored back to back, with the offset each one ends at
+      struct StringColumn
+      {
+        std::string Data;
+        std::vector<uint32_t> Ends;
+
+        std::string Get(std::size_t index) const
+        {
+          std::size_t begin = index == 0 ? 0 : Ends[index - 1];
+          return Data.substr(begin, Ends[index] - begin);
+        }
+
+        void EndString() { Ends.push_back(static_cast<uint32_t>(Data.length())); }
+
+        void ShrinkToFit()
+        {
+          Data.shrink_to_fit();
+          Ends.shrink_to_fit();
+        }
+      };
+
+      // gives back what the columns over-allocated while growing, once the page is complete
+      void ShrinkToFit()
+      {
+        for (auto column : {&m_names, &m_eTags, &m_contentMd5s, &m_snapshots, &m_versionIds})
+        {
+          column->ShrinkToFit();
+        }
+        m_blobSizes.shrink_to_fit();
+        m_lastModified.shrink_to_fit();
+        m_createdOn.shrink_to_fit();
+        m_flags.shrink_to_fit();
+        m_sharedProperties.ShrinkToFit();
+        m_sharedPropertiesIndex.shrink_to_fit();
+      }
+
+      constexpr static uint8_t DeletedFlag = 1;
+      constexpr static uint8_t HasVersionIdFlag = 2;
+
+      StringColumn m_names;
+      StringColumn m_eTags;
+      StringColumn m_contentMd5s; // as sent by the service, base64 encoded
+      StringColumn m_snapshots;
+      StringColumn m_versionIds;
+      std::vector<int64_t> m_blobSizes;
+      std::vector<Azure::Core::DateTime> m_lastModified;
+      std::vector<Azure::Core::DateTime> m_createdOn;
+      std::vector<uint8_t> m_flags;
+      // the remaining elements of a <Blob>, as XML, once for every distinct combination
+      StringColumn m_sharedProperties;
+      std::vector<uint32_t> m_sharedPropertiesIndex;
+
+      friend class Blobs::Details::BlobRestClient;
+    }; // class CompactBlobItemList
+
+    struct ListBlobsCompactSinglePageResult
+    {
+      std::string RequestId;
+      std::string ServiceEndpoint;
+      std::string BlobContainerName;
+      std::string Prefix;
+      Azure::Core::Nullable<std::string> ContinuationToken;
+      CompactBlobItemList Items;
+    }; // struct ListBlobsCompactSinglePageResult
+
   } // namespace Models
 
   namespace Details {
@@ -3090,6 +3233,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           Storage::Metadata Metadata;
           Azure::Core::Nullable<std::string> DefaultEncryptionScope;
           Azure::Core::Nullable<bool> PreventEncryptionScopeOverride;
+          bool ThrowOnError = true;
         }; // struct CreateBlobContainerOptions
 
         static Azure::Core::Response<CreateBlobContainerResult> Create(
@@ -3135,6 +3279,10 @@ namespace Azure { namespace Storage { namespace Blobs {
                   httpResponse.GetStatusCode());
           if (!(http_status_code == 201))
           {
+            if (!options.ThrowOnError)
+            {
+              return Azure::Core::Response<CreateBlobContainerResult>(std::move(pHttpResponse));
+            }
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
           response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
@@ -3152,6 +3300,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::Nullable<std::string> LeaseId;
           Azure::Core::Nullable<Azure::Core::DateTime> IfModifiedSince;
           Azure::Core::Nullable<Azure::Core::DateTime> IfUnmodifiedSince;
+          bool ThrowOnError = true;
         }; // struct DeleteBlobContainerOptions
 
         static Azure::Core::Response<DeleteBlobContainerResult> Delete(
@@ -3195,6 +3344,10 @@ namespace Azure { namespace Storage { namespace Blobs {
                   httpResponse.GetStatusCode());
           if (!(http_status_code == 202))
           {
+            if (!options.ThrowOnError)
+            {
+              return Azure::Core::Response<DeleteBlobContainerResult>(std::move(pHttpResponse));
+            }
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
           response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
@@ -3247,6 +3400,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         {
           Azure::Core::Nullable<int32_t> Timeout;
           Azure::Core::Nullable<std::string> LeaseId;
+          bool ThrowOnError = true;
         }; // struct GetBlobContainerPropertiesOptions
 
         static Azure::Core::Response<GetBlobContainerPropertiesResult> GetProperties(
@@ -3276,6 +3430,11 @@ namespace Azure { namespace Storage { namespace Blobs {
                   httpResponse.GetStatusCode());
           if (!(http_status_code == 200))
           {
+            if (!options.ThrowOnError)
+            {
+              return Azure::Core::Response<GetBlobContainerPropertiesResult>(
+                  std::move(pHttpResponse));
+            }
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
           response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
@@ -3380,6 +3539,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::Nullable<std::string> ContinuationToken;
           Azure::Core::Nullable<int32_t> MaxResults;
           ListBlobsIncludeFlags Include = ListBlobsIncludeFlags::None;
+          std::function<void(BlobItem)> OnBlobItem;
         }; // struct ListBlobsSinglePageOptions
 
         static Azure::Core::Response<ListBlobsSinglePageResult> ListBlobsSinglePage(
@@ -3389,7 +3549,9 @@ namespace Azure { namespace Storage { namespace Blobs {
             const ListBlobsSinglePageOptions& options)
         {
           (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+          // blobs handed to a callback are parsed while the response body is being received
+          auto request = Azure::Core::Http::Request(
+              Azure::Core::Http::HttpMethod::Get, url, static_cast<bool>(options.OnBlobItem));
           request.AddHeader("x-ms-version", "2020-02-10");
           if (options.Timeout.HasValue())
           {
@@ -3430,17 +3592,81 @@ namespace Azure { namespace Storage { namespace Blobs {
           {
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
+          if (options.OnBlobItem)
+          {
+            auto bodyStream = httpResponse.GetBodyStream();
+            Storage::Details::XmlReader reader(*bodyStream, context);
+            response = ListBlobsSinglePageResultFromXml(reader, options.OnBlobItem);
+          }
+          else
           {
             const auto& httpResponseBody = httpResponse.GetBody();
             Storage::Details::XmlReader reader(
                 reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobsSinglePageResultFromXml(reader);
+            response = ListBlobsSinglePageResultFromXml(reader, nullptr);
           }
           response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
           return Azure::Core::Response<ListBlobsSinglePageResult>(
               std::move(response), std::move(pHttpResponse));
         }
 
+        static Azure::Core::Response<ListBlobsCompactSinglePageResult> ListBlobsCompactSinglePage(
+            const Azure::Core::Context& context,
+            Azure::Core::Internal::Http::HttpPipeline& pipeline,
+            const Azure::Core::Http::Url& url,
+            const ListBlobsSinglePageOptions& options)
+        {
+          // the page is parsed while the response body is being received, so that only the
+          // compact form of it is ever held in memory
+          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, true);
+          request.AddHeader("x-ms-version", "2020-02-10");
+          if (options.Timeout.HasValue())
+          {
+            request.GetUrl().AppendQueryParameter(
+                "timeout", std::to_string(options.Timeout.GetValue()));
+          }
+          request.GetUrl().AppendQueryParameter("restype", "container");
+          request.GetUrl().AppendQueryParameter("comp", "list");
+          if (options.Prefix.HasValue())
+          {
+            request.GetUrl().AppendQueryParameter(
+                "prefix", Storage::Details::UrlEncodeQueryParameter(options.Prefix.GetValue()));
+          }
+          if (options.ContinuationToken.HasValue())
+          {
+            request.GetUrl().AppendQueryParameter(
+                "marker",
+                Storage::Details::UrlEncodeQueryParameter(options.ContinuationToken.GetValue()));
+          }
+          if (options.MaxResults.HasValue())
+          {
+            request.GetUrl().AppendQueryParameter(
+                "maxresults", std::to_string(options.MaxResults.GetValue()));
+          }
+          std::string list_blobs_include_flags = ListBlobsIncludeFlagsToString(options.Include);
+          if (!list_blobs_include_flags.empty())
+          {
+            request.GetUrl().AppendQueryParameter(
+                "include", Storage::Details::UrlEncodeQueryParameter(list_blobs_include_flags));
+          }
+          auto pHttpResponse = pipeline.Send(context, request);
+          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+          auto http_status_code
+              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+                  httpResponse.GetStatusCode());
+          if (!(http_status_code == 200))
+          {
+            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+          }
+          auto bodyStream = httpResponse.GetBodyStream();
+          Storage::Details::XmlReader reader(*bodyStream, context);
+          ListBlobsCompactSinglePageResult response
+              = ListBlobsCompactSinglePageResultFromXml(reader);
+          response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
+          return Azure::Core::Response<ListBlobsCompactSinglePageResult>(
+              std::move(response), std::move(pHttpResponse));
+        }
+
         struct ListBlobsByHierarchySinglePageOptions
         {
           Azure::Core::Nullable<int32_t> Timeout;
@@ -3449,6 +3675,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::Nullable<std::string> ContinuationToken;
           Azure::Core::Nullable<int32_t> MaxResults;
           ListBlobsIncludeFlags Include = ListBlobsIncludeFlags::None;
+          std::function<void(BlobItem)> OnBlobItem;
         }; // struct ListBlobsByHierarchySinglePageOptions
 
         static Azure::Core::Response<ListBlobsByHierarchySinglePageResult>
@@ -3459,7 +3686,9 @@ namespace Azure { namespace Storage { namespace Blobs {
             const ListBlobsByHierarchySinglePageOptions& options)
         {
           (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+          // blobs handed to a callback are parsed while the response body is being received
+          auto request = Azure::Core::Http::Request(
+              Azure::Core::Http::HttpMethod::Get, url, static_cast<bool>(options.OnBlobItem));
           request.AddHeader("x-ms-version", "2020-02-10");
           if (options.Timeout.HasValue())
           {
@@ -3506,11 +3735,18 @@ namespace Azure { namespace Storage { namespace Blobs {
           {
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
+          if (options.OnBlobItem)
+          {
+            auto bodyStream = httpResponse.GetBodyStream();
+            Storage::Details::XmlReader reader(*bodyStream, context);
+            response = ListBlobsByHierarchySinglePageResultFromXml(reader, options.OnBlobItem);
+          }
+          else
           {
             const auto& httpResponseBody = httpResponse.GetBody();
             Storage::Details::XmlReader reader(
                 reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobsByHierarchySinglePageResultFromXml(reader);
+            response = ListBlobsByHierarchySinglePageResultFromXml(reader, nullptr);
           }
           response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
           return Azure::Core::Response<ListBlobsByHierarchySinglePageResult>(
@@ -4022,7 +4258,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         }
 
         static ListBlobsByHierarchySinglePageResult ListBlobsByHierarchySinglePageResultFromXml(
-            Storage::Details::XmlReader& reader)
+            Storage::Details::XmlReader& reader,
+            const std::function<void(BlobItem)>& onBlobItem)
         {
           ListBlobsByHierarchySinglePageResult ret;
           enum class XmlTagName
@@ -4097,7 +4334,14 @@ namespace Azure { namespace Storage { namespace Blobs {
               if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
               {
-                ret.Items.emplace_back(BlobItemFromXml(reader));
+                if (onBlobItem)
+                {
+                  onBlobItem(BlobItemFromXml(reader));
+                }
+                else
+                {
+                  ret.Items.emplace_back(BlobItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4146,8 +4390,374 @@ namespace Azure { namespace Storage { namespace Blobs {
           return ret;
         }
 
-        static ListBlobsSinglePageResult ListBlobsSinglePageResultFromXml(
+        static ListBlobsCompactSinglePageResult ListBlobsCompactSinglePageResultFromXml(
             Storage::Details::XmlReader& reader)
+        {
+          ListBlobsCompactSinglePageResult ret;
+          enum class XmlTagName
+          {
+            k_EnumerationResults,
+            k_Prefix,
+            k_NextMarker,
+            k_Blobs,
+            k_Blob,
+            k_Unknown,
+          };
+          std::vector<XmlTagName> path;
+          // scratch space and the distinct shared properties seen so far, for the whole page
+          std::string sharedProperties;
+          std::unordered_map<std::string, uint32_t> sharedPropertiesIndex;
+          while (true)
+          {
+            auto node = reader.Read();
+            if (node.Type == Storage::Details::XmlNodeType::End)
+            {
+              break;
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::EndTag)
+            {
+              if (path.size() > 0)
+              {
+                path.pop_back();
+              }
+              else
+              {
+                break;
+              }
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::StartTag)
+            {
+              if (std::strcmp(node.Name, "EnumerationResults") == 0)
+              {
+                path.emplace_back(XmlTagName::k_EnumerationResults);
+              }
+              else if (std::strcmp(node.Name, "Prefix") == 0)
+              {
+                path.emplace_back(XmlTagName::k_Prefix);
+              }
+              else if (std::strcmp(node.Name, "NextMarker") == 0)
+              {
+                path.emplace_back(XmlTagName::k_NextMarker);
+              }
+              else if (std::strcmp(node.Name, "Blobs") == 0)
+              {
+                path.emplace_back(XmlTagName::k_Blobs);
+              }
+              else if (std::strcmp(node.Name, "Blob") == 0)
+              {
+                path.emplace_back(XmlTagName::k_Blob);
+              }
+              else
+              {
+                path.emplace_back(XmlTagName::k_Unknown);
+              }
+              if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
+                  && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
+              {
+                CompactBlobItemFromXml(reader, ret.Items, sharedProperties, sharedPropertiesIndex);
+                path.pop_back();
+              }
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::Text)
+            {
+              if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+                  && path[1] == XmlTagName::k_Prefix)
+              {
+                ret.Prefix = node.Value;
+              }
+              else if (
+                  path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+                  && path[1] == XmlTagName::k_NextMarker)
+              {
+                ret.ContinuationToken = node.Value;
+              }
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::Attribute)
+            {
+              if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+                  && std::strcmp(node.Name, "ServiceEndpoint") == 0)
+              {
+                ret.ServiceEndpoint = node.Value;
+              }
+              else if (
+                  path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+                  && std::strcmp(node.Name, "ContainerName") == 0)
+              {
+                ret.BlobContainerName = node.Value;
+              }
+            }
+          }
+          ret.Items.ShrinkToFit();
+          return ret;
+        }
+
+        static void AppendEscapedXml(std::string& xml, const char* text, bool isAttribute)
+        {
+          for (; *text; ++text)
+          {
+            switch (*text)
+            {
+              case '&':
+                xml += "&amp;";
+                break;
+              case '<':
+                xml += "&lt;";
+                break;
+              case '>':
+                xml += "&gt;";
+                break;
+              case '"':
+                xml += isAttribute ? "&quot;" : "\"";
+                break;
+              case '\r':
+                xml += "&#13;";
+                break;
+              case '\n':
+                xml += isAttribute ? "&#10;" : "\n";
+                break;
+              case '\t':
+                xml += isAttribute ? "&#9;" : "\t";
+                break;
+              default:
+                xml += *text;
+            }
+          }
+        }
+
+        // Appends one <Blob> to a compact list. The properties that differ from blob to blob go
+        // to their own columns, everything else is written back out as XML into sharedProperties
+        // and only stored if no earlier blob of the page had the same.
+        static void CompactBlobItemFromXml(
+            Storage::Details::XmlReader& reader,
+            CompactBlobItemList& items,
+            std::string& sharedProperties,
+            std::unordered_map<std::string, uint32_t>& sharedPropertiesIndex)
+        {
+          enum class Column
+          {
+            k_None,
+            k_Name,
+            k_Deleted,
+            k_Snapshot,
+            k_VersionId,
+            k_CreationTime,
+            k_LastModified,
+            k_Etag,
+            k_ContentLength,
+            k_ContentMD5,
+          };
+          auto columnOf = [](const char* name, int depth, bool inProperties) {
+            if (depth == 0)
+            {
+              if (std::strcmp(name, "Name") == 0)
+              {
+                return Column::k_Name;
+              }
+              else if (std::strcmp(name, "Deleted") == 0)
+              {
+                return Column::k_Deleted;
+              }
+              else if (std::strcmp(name, "Snapshot") == 0)
+              {
+                return Column::k_Snapshot;
+              }
+              else if (std::strcmp(name, "VersionId") == 0)
+              {
+                return Column::k_VersionId;
+              }
+            }
+            else if (depth == 1 && inProperties)
+            {
+              if (std::strcmp(name, "Creation-Time") == 0)
+              {
+                return Column::k_CreationTime;
+              }
+              else if (std::strcmp(name, "Last-Modified") == 0)
+              {
+                return Column::k_LastModified;
+              }
+              else if (std::strcmp(name, "Etag") == 0)
+              {
+                return Column::k_Etag;
+              }
+              else if (std::strcmp(name, "Content-Length") == 0)
+              {
+                return Column::k_ContentLength;
+              }
+              else if (std::strcmp(name, "Content-MD5") == 0)
+              {
+                return Column::k_ContentMD5;
+              }
+            }
+            return Column::k_None;
+          };
+
+          sharedProperties.clear();
+          int64_t blobSize = 0;
+          Azure::Core::DateTime createdOn;
+          Azure::Core::DateTime lastModified;
+          uint8_t flags = 0;
+          Column column = Column::k_None;
+          // depth below <Blob>, and whether the element at depth 1 is <Properties>
+          int depth = 0;
+          bool inProperties = false;
+          // the attributes of a start tag come after it, so it's only closed on the next node
+          const char* pendingTagEnd = nullptr;
+          bool skipAttributes = false;
+          while (true)
+          {
+            auto node = reader.Read();
+            if (node.Type == Storage::Details::XmlNodeType::Attribute)
+            {
+              if (column == Column::k_None && !skipAttributes)
+              {
+                sharedProperties += ' ';
+                sharedProperties += node.Name;
+                sharedProperties += "=\"";
+                AppendEscapedXml(sharedProperties, node.Value, true);
+                sharedProperties += '"';
+              }
+              continue;
+            }
+            skipAttributes = false;
+            if (pendingTagEnd)
+            {
+              sharedProperties += pendingTagEnd;
+              pendingTagEnd = nullptr;
+            }
+            if (node.Type == Storage::Details::XmlNodeType::End)
+            {
+              break;
+            }
+            else if (column != Column::k_None)
+            {
+              if (node.Type == Storage::Details::XmlNodeType::EndTag)
+              {
+                column = Column::k_None;
+                --depth;
+              }
+              else if (node.Type != Storage::Details::XmlNodeType::Text)
+              {
+                // not one of the simple values these columns are for
+                throw std::runtime_error("failed to parse xml");
+              }
+              else if (column == Column::k_Name)
+              {
+                items.m_names.Data += node.Value;
+              }
+              else if (column == Column::k_Deleted)
+              {
+                if (std::strcmp(node.Value, "true") == 0)
+                {
+                  flags |= CompactBlobItemList::DeletedFlag;
+                }
+              }
+              else if (column == Column::k_Snapshot)
+              {
+                items.m_snapshots.Data += node.Value;
+              }
+              else if (column == Column::k_VersionId)
+              {
+                items.m_versionIds.Data += node.Value;
+                flags |= CompactBlobItemList::HasVersionIdFlag;
+              }
+              else if (column == Column::k_CreationTime)
+              {
+                createdOn = Azure::Core::DateTime::Parse(
+                    node.Value, Azure::Core::DateTime::DateFormat::Rfc1123);
+              }
+              else if (column == Column::k_LastModified)
+              {
+                lastModified = Azure::Core::DateTime::Parse(
+                    node.Value, Azure::Core::DateTime::DateFormat::Rfc1123);
+              }
+              else if (column == Column::k_Etag)
+              {
+                items.m_eTags.Data += node.Value;
+              }
+              else if (column == Column::k_ContentLength)
+              {
+                blobSize = std::stoll(node.Value);
+              }
+              else if (column == Column::k_ContentMD5)
+              {
+                items.m_contentMd5s.Data += node.Value;
+              }
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::StartTag)
+            {
+              column = columnOf(node.Name, depth, inProperties);
+              if (column == Column::k_None)
+              {
+                if (depth == 0 && std::strcmp(node.Name, "Properties") == 0)
+                {
+                  inProperties = true;
+                }
+                sharedProperties += '<';
+                sharedProperties += node.Name;
+                pendingTagEnd = ">";
+              }
+              ++depth;
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::SelfClosingTag)
+            {
+              if (columnOf(node.Name, depth, inProperties) == Column::k_None)
+              {
+                sharedProperties += '<';
+                sharedProperties += node.Name;
+                pendingTagEnd = "/>";
+              }
+              else
+              {
+                skipAttributes = true;
+              }
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::EndTag)
+            {
+              if (depth == 0)
+              {
+                break;
+              }
+              if (--depth == 0)
+              {
+                inProperties = false;
+              }
+              sharedProperties += "</";
+              sharedProperties += node.Name;
+              sharedProperties += '>';
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::Text)
+            {
+              AppendEscapedXml(sharedProperties, node.Value, false);
+            }
+          }
+
+          items.m_names.EndString();
+          items.m_eTags.EndString();
+          items.m_contentMd5s.EndString();
+          items.m_snapshots.EndString();
+          items.m_versionIds.EndString();
+          items.m_blobSizes.push_back(blobSize);
+          items.m_lastModified.push_back(lastModified);
+          items.m_createdOn.push_back(createdOn);
+          items.m_flags.push_back(flags);
+          auto ite = sharedPropertiesIndex.find(sharedProperties);
+          if (ite == sharedPropertiesIndex.end())
+          {
+            items.m_sharedProperties.Data += sharedProperties;
+            items.m_sharedProperties.EndString();
+            ite = sharedPropertiesIndex
+                      .emplace(
+                          sharedProperties,
+                          static_cast<uint32_t>(items.m_sharedProperties.Ends.size() - 1))
+                      .first;
+          }
+          items.m_sharedPropertiesIndex.push_back(ite->second);
+        }
+
+        static ListBlobsSinglePageResult ListBlobsSinglePageResultFromXml(
+            Storage::Details::XmlReader& reader,
+            const std::function<void(BlobItem)>& onBlobItem)
         {
           ListBlobsSinglePageResult ret;
           enum class XmlTagName
@@ -4207,7 +4817,14 @@ namespace Azure { namespace Storage { namespace Blobs {
               if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
               {
-                ret.Items.emplace_back(BlobItemFromXml(reader));
+                if (onBlobItem)
+                {
+                  onBlobItem(BlobItemFromXml(reader));
+                }
+                else
+                {
+                  ret.Items.emplace_back(BlobItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4826,6 +5443,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           writer.Write(Storage::Details::XmlNode{Storage::Details::XmlNodeType::EndTag});
         }
 
+        friend class Models::CompactBlobItemList;
       }; // class BlobContainer
 
       class Blob {
@@ -5204,6 +5822,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::ETag IfMatch;
           Azure::Core::ETag IfNoneMatch;
           Azure::Core::Nullable<std::string> IfTags;
+          bool ThrowOnError = true;
         }; // struct DeleteBlobOptions
 
         static Azure::Core::Http::Request DeleteCreateMessage(
@@ -5282,6 +5901,11 @@ namespace Azure { namespace Storage { namespace Blobs {
         {
           auto request = DeleteCreateMessage(url, options);
           auto pHttpResponse = pipeline.Send(context, request);
+          if (!options.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Accepted)
+          {
+            return Azure::Core::Response<DeleteBlobResult>(std::move(pHttpResponse));
+          }
           return DeleteCreateResponse(context, std::move(pHttpResponse));
         }
 
@@ -5376,6 +6000,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::ETag IfMatch;
           Azure::Core::ETag IfNoneMatch;
           Azure::Core::Nullable<std::string> IfTags;
+          bool ThrowOnError = true;
         }; // struct GetBlobPropertiesOptions
 
         static Azure::Core::Response<GetBlobPropertiesResult> GetProperties(
@@ -5445,6 +6070,10 @@ namespace Azure { namespace Storage { namespace Blobs {
                   httpResponse.GetStatusCode());
           if (!(http_status_code == 200))
           {
+            if (!options.ThrowOnError)
+            {
+              return Azure::Core::Response<GetBlobPropertiesResult>(std::move(pHttpResponse));
+            }
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
           response.RequestId = httpResponse.GetHeaders().at("x-ms-request-id");
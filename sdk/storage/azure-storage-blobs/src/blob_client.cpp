@@ -3,10 +3,20 @@
 
 #include "azure/storage/blobs/blob_client.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
 #include <azure/core/http/policy.hpp>
 #include <azure/storage/common/concurrent_transfer.hpp>
 #include <azure/storage/common/constants.hpp>
+#include <azure/storage/common/crypt.hpp>
 #include <azure/storage/common/file_io.hpp>
+#include <azure/storage/common/read_ahead_stream.hpp>
 #include <azure/storage/common/reliable_stream.hpp>
 #include <azure/storage/common/shared_key_policy.hpp>
 #include <azure/storage/common/storage_common.hpp>
@@ -19,6 +29,582 @@
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    Azure::Core::Response<Models::DownloadBlobToResult> ToDownloadBlobToResult(
+        Azure::Core::Response<Models::DownloadBlobResult>& response)
+    {
+      Models::DownloadBlobToResult ret;
+      ret.BlobType = std::move(response->BlobType);
+      ret.ContentRange = std::move(response->ContentRange);
+      ret.BlobSize = response->BlobSize;
+      ret.TransactionalContentHash = std::move(response->TransactionalContentHash);
+      ret.Details = std::move(response->Details);
+      return Azure::Core::Response<Models::DownloadBlobToResult>(
+          std::move(ret), response.ExtractRawResponse());
+    }
+
+    int64_t GetDownloadRangeSize(const DownloadBlobToOptions& options, int64_t blobSize)
+    {
+      if (!options.Range.HasValue())
+      {
+        return blobSize;
+      }
+      int64_t blobRangeSize = std::max(blobSize - options.Range.GetValue().Offset, int64_t(0));
+      if (options.Range.GetValue().Length.HasValue())
+      {
+        blobRangeSize = std::min(blobRangeSize, options.Range.GetValue().Length.GetValue());
+      }
+      return blobRangeSize;
+    }
+
+    // Where DownloadTo puts the downloaded bytes.
+    struct DownloadSink
+    {
+      // Called once the size of the range is known, before anything is written. Called again if
+      // the download starts over.
+      std::function<void(int64_t)> SetRangeSize;
+      // The largest range SetRangeSize accepts.
+      int64_t MaxRangeSize = std::numeric_limits<int64_t>::max();
+      // body stream, offset from the start of the range, length
+      std::function<void(Azure::Core::Http::BodyStream&, int64_t, int64_t)> WriteChunk;
+    };
+
+    // Hashes the data read through it.
+    class HashingBodyStream : public Azure::Core::Http::BodyStream {
+    public:
+      HashingBodyStream(Azure::Core::Http::BodyStream& inner, Azure::Core::Cryptography::Hash& hash)
+          : m_inner(inner), m_hash(hash)
+      {
+      }
+
+      int64_t Length() const override { return m_inner.Length(); }
+
+    private:
+      int64_t OnRead(const Azure::Core::Context& context, uint8_t* buffer, int64_t count) override
+      {
+        const int64_t bytesRead = m_inner.Read(context, buffer, count);
+        m_hash.Append(buffer, static_cast<std::size_t>(bytesRead));
+        return bytesRead;
+      }
+
+      Azure::Core::Http::BodyStream& m_inner;
+      Azure::Core::Cryptography::Hash& m_hash;
+    };
+
+    // The service only returns the hash of ranges up to this size.
+    constexpr int64_t MaxHashedRangeSize = 4 * 1024 * 1024;
+    constexpr int MaxChunkDownloadAttempts = 3;
+
+    void SetChunkRange(
+        DownloadBlobOptions& chunkOptions,
+        int64_t offset,
+        int64_t length,
+        const DownloadBlobToOptions& options)
+    {
+      chunkOptions.Range = Core::Http::Range();
+      chunkOptions.Range.GetValue().Offset = offset;
+      chunkOptions.Range.GetValue().Length = length;
+      chunkOptions.RangeHashAlgorithm = options.TransactionalHashAlgorithm;
+    }
+
+    // Writes length bytes of the chunk, which starts at offset in the blob, to the sink. When
+    // verifying, the chunk is hashed while it's written and downloaded again if the hash doesn't
+    // match the one returned by the service, chunk then holds the last response.
+    void WriteChunk(
+        const BlobClient& blobClient,
+        const DownloadBlobToOptions& options,
+        const DownloadSink& sink,
+        Azure::Core::Response<Models::DownloadBlobResult>& chunk,
+        int64_t offset,
+        int64_t offsetInRange,
+        int64_t length,
+        const Azure::Core::Context& context)
+    {
+      if (!options.TransactionalHashAlgorithm.HasValue() || length == 0)
+      {
+        sink.WriteChunk(*(chunk->BodyStream), offsetInRange, length);
+        return;
+      }
+
+      const HashAlgorithm algorithm = options.TransactionalHashAlgorithm.GetValue();
+      for (int attempt = 1;; ++attempt)
+      {
+        std::unique_ptr<Azure::Core::Cryptography::Hash> hash;
+        if (algorithm == HashAlgorithm::Crc64)
+        {
+          hash = std::make_unique<Crc64Hash>();
+        }
+        else
+        {
+          hash = std::make_unique<Azure::Core::Cryptography::Md5Hash>();
+        }
+        HashingBodyStream hashingStream(*(chunk->BodyStream), *hash);
+        sink.WriteChunk(hashingStream, offsetInRange, length);
+
+        if (!chunk->TransactionalContentHash.HasValue()
+            || chunk->TransactionalContentHash.GetValue().Algorithm != algorithm)
+        {
+          throw StorageException("service didn't return the hash of the downloaded range");
+        }
+        if (hash->Final() == chunk->TransactionalContentHash.GetValue().Value)
+        {
+          return;
+        }
+        if (attempt == MaxChunkDownloadAttempts)
+        {
+          throw StorageException(
+              "hash of the downloaded range doesn't match the hash returned by the service");
+        }
+
+        DownloadBlobOptions chunkOptions;
+        SetChunkRange(chunkOptions, offset, length, options);
+        chunkOptions.AccessConditions.IfMatch = chunk->Details.ETag;
+        chunk = blobClient.Download(chunkOptions, context);
+      }
+    }
+
+    // Thrown when chunks that were requested before the ETag of the blob was known turn out not to
+    // belong together, either because the blob changed or because the size hint was wrong.
+    struct SpeculativeDownloadFailed
+    {
+    };
+
+    struct SpeculativeDownloadResult
+    {
+      Azure::Core::ETag ETag;
+      int64_t BlobRangeSize = -1;
+      // Response of the chunk with the highest offset.
+      Azure::Core::Nullable<Azure::Core::Response<Models::DownloadBlobToResult>> LastChunk;
+      int64_t LastChunkOffset = -1;
+    };
+
+    // Downloads the first length bytes of the range in chunks, all of them at once. Chunks past the
+    // end of the blob are skipped. Since nothing pins the version of the blob, the chunks are
+    // checked to have the same ETag and to agree on the size of the blob range, which is
+    // blobRangeSize if known upfront or -1.
+    SpeculativeDownloadResult DownloadSpeculatively(
+        const BlobClient& blobClient,
+        const DownloadBlobToOptions& options,
+        const DownloadSink& sink,
+        int64_t length,
+        int concurrency,
+        int64_t blobRangeSize,
+        const Azure::Core::Context& context)
+    {
+      const int64_t rangeOffset = options.Range.HasValue() ? options.Range.GetValue().Offset : 0;
+
+      SpeculativeDownloadResult result;
+      result.BlobRangeSize = blobRangeSize;
+      int64_t firstSkippedOffset = std::numeric_limits<int64_t>::max();
+      std::mutex resultMutex;
+
+      auto downloadChunkFunc = [&](int64_t offset, int64_t chunkLength, int64_t chunkId, int64_t) {
+        DownloadBlobOptions chunkOptions;
+        SetChunkRange(chunkOptions, offset, chunkLength, options);
+        Azure::Core::Nullable<Azure::Core::Response<Models::DownloadBlobResult>> chunk;
+        try
+        {
+          chunk = blobClient.Download(chunkOptions, context);
+        }
+        catch (StorageException& e)
+        {
+          if (e.StatusCode != Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+          {
+            throw;
+          }
+          if (chunkId == 0 || blobRangeSize != -1)
+          {
+            throw SpeculativeDownloadFailed();
+          }
+          std::lock_guard<std::mutex> guard(resultMutex);
+          firstSkippedOffset = std::min(firstSkippedOffset, offset - rangeOffset);
+          return;
+        }
+        auto& response = chunk.GetValue();
+
+        const int64_t chunkBlobRangeSize = GetDownloadRangeSize(options, response->BlobSize);
+        {
+          std::lock_guard<std::mutex> guard(resultMutex);
+          if (result.BlobRangeSize == -1)
+          {
+            result.BlobRangeSize = chunkBlobRangeSize;
+            sink.SetRangeSize(chunkBlobRangeSize);
+          }
+          if (!result.ETag.HasValue())
+          {
+            result.ETag = response->Details.ETag;
+          }
+          if (chunkBlobRangeSize != result.BlobRangeSize || response->Details.ETag != result.ETag)
+          {
+            throw SpeculativeDownloadFailed();
+          }
+        }
+
+        const int64_t offsetInRange = offset - rangeOffset;
+        const int64_t bytesInChunk = std::min(chunkLength, chunkBlobRangeSize - offsetInRange);
+        if (bytesInChunk <= 0)
+        {
+          throw SpeculativeDownloadFailed();
+        }
+        WriteChunk(
+            blobClient, options, sink, response, offset, offsetInRange, bytesInChunk, context);
+        response->BodyStream.reset();
+
+        std::lock_guard<std::mutex> guard(resultMutex);
+        if (offsetInRange > result.LastChunkOffset)
+        {
+          result.LastChunk = ToDownloadBlobToResult(response);
+          result.LastChunkOffset = offsetInRange;
+        }
+      };
+
+      Storage::Details::ConcurrentTransfer(
+          rangeOffset,
+          length,
+          options.TransferOptions.ChunkSize,
+          concurrency,
+          downloadChunkFunc,
+          context);
+
+      if (firstSkippedOffset < result.BlobRangeSize)
+      {
+        // The blob got shorter than the chunks that did get data said it was.
+        throw SpeculativeDownloadFailed();
+      }
+      return result;
+    }
+
+    Azure::Core::Response<Models::DownloadBlobToResult> DownloadToSink(
+        const BlobClient& blobClient,
+        const DownloadBlobToOptions& downloadOptions,
+        const DownloadSink& sink,
+        const Azure::Core::Context& context)
+    {
+      DownloadBlobToOptions options = downloadOptions;
+      if (options.TransactionalHashAlgorithm.HasValue())
+      {
+        // Split into ranges the service returns the hash of.
+        options.TransferOptions.InitialChunkSize
+            = std::min(options.TransferOptions.InitialChunkSize, MaxHashedRangeSize);
+        options.TransferOptions.ChunkSize
+            = std::min(options.TransferOptions.ChunkSize, MaxHashedRangeSize);
+      }
+
+      const int64_t firstChunkOffset
+          = options.Range.HasValue() ? options.Range.GetValue().Offset : 0;
+      const int64_t chunkSize = options.TransferOptions.ChunkSize;
+      const int speculativeRequestCount = options.TransferOptions.SpeculativeRequestCount;
+
+      // If we know the size of the blob, or are allowed to guess, there's no need to wait for the
+      // initial chunk before starting the parallel requests.
+      try
+      {
+        Azure::Core::Nullable<SpeculativeDownloadResult> speculativeResult;
+        const int64_t hintedRangeSize = options.BlobSizeHint.HasValue()
+            ? GetDownloadRangeSize(options, options.BlobSizeHint.GetValue())
+            : 0;
+        // A hint the sink can't take may still be wrong, so leave the size check to the actual
+        // blob.
+        if (hintedRangeSize > 0 && hintedRangeSize <= sink.MaxRangeSize)
+        {
+          const int64_t blobRangeSize = hintedRangeSize;
+          sink.SetRangeSize(blobRangeSize);
+          speculativeResult = DownloadSpeculatively(
+              blobClient,
+              options,
+              sink,
+              blobRangeSize,
+              options.TransferOptions.Concurrency,
+              blobRangeSize,
+              context);
+        }
+        else if (speculativeRequestCount > 1)
+        {
+          int64_t length = chunkSize * speculativeRequestCount;
+          if (options.Range.HasValue() && options.Range.GetValue().Length.HasValue())
+          {
+            length = std::min(length, options.Range.GetValue().Length.GetValue());
+          }
+          speculativeResult = DownloadSpeculatively(
+              blobClient, options, sink, length, speculativeRequestCount, -1, context);
+
+          const Azure::Core::ETag eTag = speculativeResult.GetValue().ETag;
+          auto& ret = speculativeResult.GetValue().LastChunk.GetValue();
+          auto downloadChunkFunc
+              = [&](int64_t offset, int64_t chunkLength, int64_t chunkId, int64_t numChunks) {
+                  DownloadBlobOptions chunkOptions;
+                  SetChunkRange(chunkOptions, offset, chunkLength, options);
+                  chunkOptions.AccessConditions.IfMatch = eTag;
+                  auto chunk = blobClient.Download(chunkOptions, context);
+                  WriteChunk(
+                      blobClient,
+                      options,
+                      sink,
+                      chunk,
+                      offset,
+                      offset - firstChunkOffset,
+                      chunkLength,
+                      context);
+
+                  if (chunkId == numChunks - 1)
+                  {
+                    ret = ToDownloadBlobToResult(chunk);
+                    speculativeResult.GetValue().LastChunkOffset = offset - firstChunkOffset;
+                  }
+                };
+          // Keep downloading the remaining in parallel
+          Storage::Details::ConcurrentTransfer(
+              firstChunkOffset + length,
+              std::max(speculativeResult.GetValue().BlobRangeSize - length, int64_t(0)),
+              chunkSize,
+              options.TransferOptions.Concurrency,
+              downloadChunkFunc,
+              context);
+        }
+
+        if (speculativeResult.HasValue())
+        {
+          auto& result = speculativeResult.GetValue();
+          auto ret = std::move(result.LastChunk.GetValue());
+          if (result.LastChunkOffset != 0)
+          {
+            ret->TransactionalContentHash.Reset();
+          }
+          ret->ContentRange.Offset = firstChunkOffset;
+          ret->ContentRange.Length = result.BlobRangeSize;
+          return ret;
+        }
+      }
+      catch (SpeculativeDownloadFailed&)
+      {
+        // Start over the regular way.
+      }
+
+      // Just start downloading using an initial chunk. If it's a small blob, we'll get the whole
+      // thing in one shot. If it's a large blob, we'll get its full size in Content-Range and can
+      // keep downloading it in chunks.
+      int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
+      if (options.Range.HasValue() && options.Range.GetValue().Length.HasValue())
+      {
+        firstChunkLength = std::min(firstChunkLength, options.Range.GetValue().Length.GetValue());
+      }
+
+      DownloadBlobOptions firstChunkOptions;
+      firstChunkOptions.Range = options.Range;
+      if (firstChunkOptions.Range.HasValue())
+      {
+        firstChunkOptions.Range.GetValue().Length = firstChunkLength;
+      }
+      else if (options.TransactionalHashAlgorithm.HasValue())
+      {
+        // The hash is only returned for ranges.
+        SetChunkRange(firstChunkOptions, 0, firstChunkLength, options);
+      }
+      firstChunkOptions.RangeHashAlgorithm = options.TransactionalHashAlgorithm;
+
+      Azure::Core::Nullable<Azure::Core::Response<Models::DownloadBlobResult>> firstChunkResponse;
+      try
+      {
+        firstChunkResponse = blobClient.Download(firstChunkOptions, context);
+      }
+      catch (StorageException& e)
+      {
+        if (options.Range.HasValue() || !firstChunkOptions.Range.HasValue()
+            || e.StatusCode != Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+        {
+          throw;
+        }
+        // The blob is empty, there's nothing to verify.
+        firstChunkResponse = blobClient.Download(DownloadBlobOptions(), context);
+      }
+      auto& firstChunk = firstChunkResponse.GetValue();
+      const Azure::Core::ETag eTag = firstChunk->Details.ETag;
+
+      const int64_t blobRangeSize = GetDownloadRangeSize(options, firstChunk->BlobSize);
+      firstChunkLength = std::min(firstChunkLength, blobRangeSize);
+
+      sink.SetRangeSize(blobRangeSize);
+      WriteChunk(
+          blobClient, options, sink, firstChunk, firstChunkOffset, 0, firstChunkLength, context);
+      firstChunk->BodyStream.reset();
+
+      auto ret = ToDownloadBlobToResult(firstChunk);
+
+      // Keep downloading the remaining in parallel
+      auto downloadChunkFunc
+          = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+              DownloadBlobOptions chunkOptions;
+              SetChunkRange(chunkOptions, offset, length, options);
+              chunkOptions.AccessConditions.IfMatch = eTag;
+              auto chunk = blobClient.Download(chunkOptions, context);
+              WriteChunk(
+                  blobClient,
+                  options,
+                  sink,
+                  chunk,
+                  offset,
+                  offset - firstChunkOffset,
+                  length,
+                  context);
+
+              if (chunkId == numChunks - 1)
+              {
+                ret = ToDownloadBlobToResult(chunk);
+                ret->TransactionalContentHash.Reset();
+              }
+            };
+
+      int64_t remainingOffset = firstChunkOffset + firstChunkLength;
+      int64_t remainingSize = blobRangeSize - firstChunkLength;
+
+      Storage::Details::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context);
+      ret->ContentRange.Offset = firstChunkOffset;
+      ret->ContentRange.Length = blobRangeSize;
+      return ret;
+    }
+
+    // A part of a range passed to DownloadRanges and where it goes.
+    struct RangeSegment
+    {
+      int64_t Offset;
+      int64_t Length;
+      uint8_t* Buffer;
+    };
+
+    // A single request made by DownloadRanges.
+    struct RangeRequest
+    {
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      // sorted by offset
+      std::vector<RangeSegment> Segments;
+    };
+
+    std::vector<RangeRequest> PlanRangeRequests(
+        const std::vector<BlobRangeBuffer>& ranges,
+        int64_t mergeGapSize,
+        int64_t chunkSize)
+    {
+      std::vector<RangeSegment> segments;
+      for (const auto& range : ranges)
+      {
+        if (range.Offset < 0 || range.Length < 0 || (range.Length > 0 && range.Buffer == nullptr))
+        {
+          throw std::invalid_argument("invalid blob range");
+        }
+        if (range.Length > 0)
+        {
+          segments.push_back(RangeSegment{range.Offset, range.Length, range.Buffer});
+        }
+      }
+      std::sort(
+          segments.begin(), segments.end(), [](const RangeSegment& a, const RangeSegment& b) {
+            return a.Offset < b.Offset;
+          });
+
+      chunkSize = std::max(chunkSize, int64_t(1));
+      std::vector<RangeRequest> requests;
+      std::size_t spanBegin = 0;
+      while (spanBegin < segments.size())
+      {
+        // Ranges that overlap or are close enough are merged into a span, which is then split
+        // into requests of at most chunkSize bytes.
+        const int64_t spanOffset = segments[spanBegin].Offset;
+        int64_t spanEndOffset = spanOffset + segments[spanBegin].Length;
+        std::size_t spanEnd = spanBegin + 1;
+        while (spanEnd < segments.size()
+               && segments[spanEnd].Offset - spanEndOffset <= mergeGapSize)
+        {
+          spanEndOffset
+              = std::max(spanEndOffset, segments[spanEnd].Offset + segments[spanEnd].Length);
+          ++spanEnd;
+        }
+
+        for (int64_t offset = spanOffset; offset < spanEndOffset; offset += chunkSize)
+        {
+          const int64_t endOffset = std::min(offset + chunkSize, spanEndOffset);
+          RangeRequest request;
+          int64_t requestEndOffset = offset;
+          for (std::size_t i = spanBegin; i < spanEnd; ++i)
+          {
+            const auto& segment = segments[i];
+            const int64_t begin = std::max(segment.Offset, offset);
+            const int64_t end = std::min(segment.Offset + segment.Length, endOffset);
+            if (begin < end)
+            {
+              request.Segments.push_back(
+                  RangeSegment{begin, end - begin, segment.Buffer + (begin - segment.Offset)});
+              requestEndOffset = std::max(requestEndOffset, end);
+            }
+          }
+          if (!request.Segments.empty())
+          {
+            // Don't download the parts of the gaps at the edges of the request.
+            request.Offset = request.Segments.front().Offset;
+            request.Length = requestEndOffset - request.Offset;
+            requests.push_back(std::move(request));
+          }
+        }
+        spanBegin = spanEnd;
+      }
+      return requests;
+    }
+
+    void ReadBodyStream(
+        Azure::Core::Http::BodyStream& stream,
+        uint8_t* buffer,
+        int64_t length,
+        const Azure::Core::Context& context)
+    {
+      int64_t bytesRead
+          = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer, length);
+      if (bytesRead != length)
+      {
+        throw Azure::Core::RequestFailedException("error when reading body stream");
+      }
+    }
+
+    void ReadRangeRequest(
+        Azure::Core::Http::BodyStream& stream,
+        const RangeRequest& request,
+        const Azure::Core::Context& context)
+    {
+      int64_t offset = request.Offset;
+      bool contiguous = true;
+      for (const auto& segment : request.Segments)
+      {
+        contiguous = contiguous && segment.Offset == offset;
+        offset = segment.Offset + segment.Length;
+      }
+
+      if (contiguous)
+      {
+        // The segments cover the request back to back, read them straight into place.
+        for (const auto& segment : request.Segments)
+        {
+          ReadBodyStream(stream, segment.Buffer, segment.Length, context);
+        }
+        return;
+      }
+
+      std::vector<uint8_t> buffer(static_cast<std::size_t>(request.Length));
+      ReadBodyStream(stream, buffer.data(), request.Length, context);
+      for (const auto& segment : request.Segments)
+      {
+        std::memcpy(
+            segment.Buffer,
+            buffer.data() + (segment.Offset - request.Offset),
+            static_cast<std::size_t>(segment.Length));
+      }
+    }
+  } // namespace
+
   BlobClient BlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -234,109 +820,26 @@ namespace Azure { namespace Storage { namespace Blobs {
       const DownloadBlobToOptions& options,
       const Azure::Core::Context& context) const
   {
-    // Just start downloading using an initial chunk. If it's a small blob, we'll get the whole
-    // thing in one shot. If it's a large blob, we'll get its full size in Content-Range and can
-    // keep downloading it in chunks.
-    const int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.GetValue().Offset : 0;
-    int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
-    if (options.Range.HasValue() && options.Range.GetValue().Length.HasValue())
-    {
-      firstChunkLength = std::min(firstChunkLength, options.Range.GetValue().Length.GetValue());
-    }
-
-    DownloadBlobOptions firstChunkOptions;
-    firstChunkOptions.Range = options.Range;
-    if (firstChunkOptions.Range.HasValue())
-    {
-      firstChunkOptions.Range.GetValue().Length = firstChunkLength;
-    }
-
-    auto firstChunk = Download(firstChunkOptions, context);
-    const Azure::Core::ETag eTag = firstChunk->Details.ETag;
-
-    const int64_t blobSize = firstChunk->BlobSize;
-    int64_t blobRangeSize;
-    if (firstChunkOptions.Range.HasValue())
-    {
-      blobRangeSize = blobSize - firstChunkOffset;
-      if (options.Range.HasValue() && options.Range.GetValue().Length.HasValue())
+    DownloadSink sink;
+    sink.MaxRangeSize = static_cast<int64_t>(
+        std::min<uint64_t>(bufferSize, std::numeric_limits<int64_t>::max()));
+    sink.SetRangeSize = [bufferSize](int64_t blobRangeSize) {
+      if (static_cast<std::size_t>(blobRangeSize) > bufferSize)
       {
-        blobRangeSize = std::min(blobRangeSize, options.Range.GetValue().Length.GetValue());
+        throw Azure::Core::RequestFailedException(
+            "buffer is not big enough, blob range size is " + std::to_string(blobRangeSize));
       }
-    }
-    else
-    {
-      blobRangeSize = blobSize;
-    }
-    firstChunkLength = std::min(firstChunkLength, blobRangeSize);
-
-    if (static_cast<std::size_t>(blobRangeSize) > bufferSize)
-    {
-      throw Azure::Core::RequestFailedException(
-          "buffer is not big enough, blob range size is " + std::to_string(blobRangeSize));
-    }
-
-    int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
-        context, *(firstChunk->BodyStream), buffer, firstChunkLength);
-    if (bytesRead != firstChunkLength)
-    {
-      throw Azure::Core::RequestFailedException("error when reading body stream");
-    }
-    firstChunk->BodyStream.reset();
-
-    auto returnTypeConverter = [](Azure::Core::Response<Models::DownloadBlobResult>& response) {
-      Models::DownloadBlobToResult ret;
-      ret.BlobType = std::move(response->BlobType);
-      ret.ContentRange = std::move(response->ContentRange);
-      ret.BlobSize = response->BlobSize;
-      ret.TransactionalContentHash = std::move(response->TransactionalContentHash);
-      ret.Details = std::move(response->Details);
-      return Azure::Core::Response<Models::DownloadBlobToResult>(
-          std::move(ret), response.ExtractRawResponse());
     };
-    auto ret = returnTypeConverter(firstChunk);
-
-    // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Range = Core::Http::Range();
-            chunkOptions.Range.GetValue().Offset = offset;
-            chunkOptions.Range.GetValue().Length = length;
-            if (!chunkOptions.AccessConditions.IfMatch.HasValue())
-            {
-              chunkOptions.AccessConditions.IfMatch = eTag;
-            }
-            auto chunk = Download(chunkOptions, context);
-            int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
-                context,
-                *(chunk->BodyStream),
-                buffer + (offset - firstChunkOffset),
-                chunkOptions.Range.GetValue().Length.GetValue());
-            if (bytesRead != chunkOptions.Range.GetValue().Length.GetValue())
-            {
-              throw Azure::Core::RequestFailedException("error when reading body stream");
-            }
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-              ret->TransactionalContentHash.Reset();
-            }
-          };
-
-    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
-    int64_t remainingSize = blobRangeSize - firstChunkLength;
-
-    Storage::Details::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
-    ret->ContentRange.Offset = firstChunkOffset;
-    ret->ContentRange.Length = blobRangeSize;
-    return ret;
+    sink.WriteChunk = [buffer, &context](
+                          Azure::Core::Http::BodyStream& stream, int64_t offset, int64_t length) {
+      int64_t bytesRead
+          = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer + offset, length);
+      if (bytesRead != length)
+      {
+        throw Azure::Core::RequestFailedException("error when reading body stream");
+      }
+    };
+    return DownloadToSink(*this, options, sink, context);
   }
 
   Azure::Core::Response<Models::DownloadBlobToResult> BlobClient::DownloadTo(
@@ -344,124 +847,176 @@ namespace Azure { namespace Storage { namespace Blobs {
       const DownloadBlobToOptions& options,
       const Azure::Core::Context& context) const
   {
-    // Just start downloading using an initial chunk. If it's a small blob, we'll get the whole
-    // thing in one shot. If it's a large blob, we'll get its full size in Content-Range and can
-    // keep downloading it in chunks.
-    const int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.GetValue().Offset : 0;
-    int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
+    auto fileWriter = std::make_unique<Storage::Details::FileWriter>(fileName);
+    bool rangeSizeSet = false;
+
+    DownloadSink sink;
+    sink.SetRangeSize = [&](int64_t) {
+      if (rangeSizeSet)
+      {
+        // The download started over, drop whatever the abandoned attempt wrote.
+        fileWriter.reset();
+        fileWriter = std::make_unique<Storage::Details::FileWriter>(fileName);
+      }
+      rangeSizeSet = true;
+    };
+    sink.WriteChunk
+        = [&](Azure::Core::Http::BodyStream& stream, int64_t offset, int64_t length) {
+            Storage::Details::BodyStreamToFile(stream, *fileWriter, offset, length, context);
+          };
+    return DownloadToSink(*this, options, sink, context);
+  }
+
+  std::unique_ptr<Azure::Core::Http::BodyStream> BlobClient::OpenRead(
+      const OpenReadBlobOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    GetBlobPropertiesOptions getPropertiesOptions;
+    getPropertiesOptions.AccessConditions = options.AccessConditions;
+    auto properties = GetProperties(getPropertiesOptions, context);
+
+    const int64_t offset = options.Range.HasValue() ? options.Range.GetValue().Offset : 0;
+    int64_t length = std::max(properties->BlobSize - offset, int64_t(0));
     if (options.Range.HasValue() && options.Range.GetValue().Length.HasValue())
     {
-      firstChunkLength = std::min(firstChunkLength, options.Range.GetValue().Length.GetValue());
+      length = std::min(length, options.Range.GetValue().Length.GetValue());
     }
 
-    DownloadBlobOptions firstChunkOptions;
-    firstChunkOptions.Range = options.Range;
-    if (firstChunkOptions.Range.HasValue())
-    {
-      firstChunkOptions.Range.GetValue().Length = firstChunkLength;
-    }
+    DownloadBlobOptions chunkOptions;
+    chunkOptions.AccessConditions = options.AccessConditions;
+    chunkOptions.AccessConditions.IfMatch = properties->ETag;
+    auto fetchChunk = [blobClient = *this, chunkOptions](
+                          int64_t chunkOffset,
+                          int64_t chunkLength,
+                          uint8_t* buffer,
+                          const Azure::Core::Context& context) {
+      DownloadBlobOptions rangeOptions = chunkOptions;
+      rangeOptions.Range = Core::Http::Range();
+      rangeOptions.Range.GetValue().Offset = chunkOffset;
+      rangeOptions.Range.GetValue().Length = chunkLength;
+      auto chunk = blobClient.Download(rangeOptions, context);
+      int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
+          context, *(chunk->BodyStream), buffer, chunkLength);
+      if (bytesRead != chunkLength)
+      {
+        throw Azure::Core::RequestFailedException("error when reading body stream");
+      }
+    };
 
-    Storage::Details::FileWriter fileWriter(fileName);
+    return std::make_unique<Storage::Details::ReadAheadStream>(
+        offset,
+        length,
+        options.TransferOptions.ChunkSize,
+        options.TransferOptions.WindowSize,
+        std::move(fetchChunk),
+        context);
+  }
 
-    auto firstChunk = Download(firstChunkOptions, context);
-    const Azure::Core::ETag eTag = firstChunk->Details.ETag;
+  BlobRandomAccessReader BlobClient::OpenRandomAccessReader(
+      const OpenBlobRandomAccessReaderOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    GetBlobPropertiesOptions getPropertiesOptions;
+    getPropertiesOptions.AccessConditions = options.AccessConditions;
+    auto properties = GetProperties(getPropertiesOptions, context);
 
-    const int64_t blobSize = firstChunk->BlobSize;
-    int64_t blobRangeSize;
-    if (firstChunkOptions.Range.HasValue())
-    {
-      blobRangeSize = blobSize - firstChunkOffset;
-      if (options.Range.HasValue() && options.Range.GetValue().Length.HasValue())
+    DownloadBlobOptions chunkOptions;
+    chunkOptions.AccessConditions = options.AccessConditions;
+    chunkOptions.AccessConditions.IfMatch = properties->ETag;
+    auto fetchRange = [blobClient = *this, chunkOptions](
+                          int64_t offset,
+                          int64_t length,
+                          uint8_t* buffer,
+                          const Azure::Core::Context& context) {
+      DownloadBlobOptions rangeOptions = chunkOptions;
+      rangeOptions.Range = Core::Http::Range();
+      rangeOptions.Range.GetValue().Offset = offset;
+      rangeOptions.Range.GetValue().Length = length;
+      auto chunk = blobClient.Download(rangeOptions, context);
+      int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
+          context, *(chunk->BodyStream), buffer, length);
+      if (bytesRead != length)
       {
-        blobRangeSize = std::min(blobRangeSize, options.Range.GetValue().Length.GetValue());
+        throw Azure::Core::RequestFailedException("error when reading body stream");
       }
-    }
-    else
+    };
+
+    return BlobRandomAccessReader(
+        std::make_shared<Storage::Details::BlockCacheReader>(
+            properties->BlobSize,
+            options.TransferOptions.BlockSize,
+            options.TransferOptions.CacheSize,
+            options.TransferOptions.ChunkSize,
+            options.TransferOptions.Concurrency,
+            std::move(fetchRange)),
+        properties->ETag);
+  }
+
+  Azure::Core::Response<Models::DownloadBlobRangesResult> BlobClient::DownloadRanges(
+      const std::vector<BlobRangeBuffer>& ranges,
+      const DownloadBlobRangesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto requests = PlanRangeRequests(
+        ranges, options.TransferOptions.MergeGapSize, options.TransferOptions.ChunkSize);
+    if (requests.empty())
     {
-      blobRangeSize = blobSize;
+      throw std::invalid_argument("no blob range to download");
     }
-    firstChunkLength = std::min(firstChunkLength, blobRangeSize);
 
-    auto bodyStreamToFile = [](Azure::Core::Http::BodyStream& stream,
-                               Storage::Details::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
-      constexpr std::size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
-      while (length > 0)
-      {
-        int64_t readSize = std::min(static_cast<int64_t>(bufferSize), length);
-        int64_t bytesRead
-            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.data(), readSize);
-        if (bytesRead != readSize)
-        {
-          throw Azure::Core::RequestFailedException("error when reading body stream");
-        }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
-        length -= bytesRead;
-        offset += bytesRead;
-      }
+    DownloadBlobOptions requestOptions;
+    requestOptions.AccessConditions = options.AccessConditions;
+    auto downloadRequest = [&](const RangeRequest& request) {
+      DownloadBlobOptions rangeOptions = requestOptions;
+      rangeOptions.Range = Core::Http::Range();
+      rangeOptions.Range.GetValue().Offset = request.Offset;
+      rangeOptions.Range.GetValue().Length = request.Length;
+      auto response = Download(rangeOptions, context);
+      ReadRangeRequest(*(response->BodyStream), request, context);
+      return response;
     };
 
-    bodyStreamToFile(*(firstChunk->BodyStream), fileWriter, 0, firstChunkLength, context);
-    firstChunk->BodyStream.reset();
-
-    auto returnTypeConverter = [](Azure::Core::Response<Models::DownloadBlobResult>& response) {
-      Models::DownloadBlobToResult ret;
-      ret.BlobType = std::move(response->BlobType);
-      ret.ContentRange = std::move(response->ContentRange);
-      ret.BlobSize = response->BlobSize;
-      ret.TransactionalContentHash = std::move(response->TransactionalContentHash);
-      ret.Details = std::move(response->Details);
-      return Azure::Core::Response<Models::DownloadBlobToResult>(
-          std::move(ret), response.ExtractRawResponse());
-    };
-    auto ret = returnTypeConverter(firstChunk);
-
-    // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Range = Core::Http::Range();
-            chunkOptions.Range.GetValue().Offset = offset;
-            chunkOptions.Range.GetValue().Length = length;
-            if (!chunkOptions.AccessConditions.IfMatch.HasValue())
-            {
-              chunkOptions.AccessConditions.IfMatch = eTag;
-            }
-            auto chunk = Download(chunkOptions, context);
-            bodyStreamToFile(
-                *(chunk->BodyStream),
-                fileWriter,
-                offset - firstChunkOffset,
-                chunkOptions.Range.GetValue().Length.GetValue(),
-                context);
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-              ret->TransactionalContentHash.Reset();
-            }
-          };
+    // The first response tells the ETag the other requests are pinned to.
+    auto firstResponse = downloadRequest(requests.front());
+    requestOptions.AccessConditions.IfMatch = firstResponse->Details.ETag;
+    const int64_t endOffset = requests.back().Offset + requests.back().Length;
+    if (endOffset > firstResponse->BlobSize)
+    {
+      throw Azure::Core::RequestFailedException(
+          "blob range exceeds blob size " + std::to_string(firstResponse->BlobSize));
+    }
 
-    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
-    int64_t remainingSize = blobRangeSize - firstChunkLength;
+    if (requests.size() > 1)
+    {
+      Storage::Details::ConcurrentTransfer(
+          1,
+          static_cast<int64_t>(requests.size()) - 1,
+          1,
+          options.TransferOptions.Concurrency,
+          [&](int64_t requestId, int64_t, int64_t, int64_t) {
+            downloadRequest(requests[static_cast<std::size_t>(requestId)]);
+          },
+          context);
+    }
 
-    Storage::Details::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
-    ret->ContentRange.Offset = firstChunkOffset;
-    ret->ContentRange.Length = blobRangeSize;
-    return ret;
+    Models::DownloadBlobRangesResult ret;
+    ret.BlobType = std::move(firstResponse->BlobType);
+    ret.BlobSize = firstResponse->BlobSize;
+    ret.Details = std::move(firstResponse->Details);
+    return Azure::Core::Response<Models::DownloadBlobRangesResult>(
+        std::move(ret), firstResponse.ExtractRawResponse());
   }
 
   Azure::Core::Response<Models::GetBlobPropertiesResult> BlobClient::GetProperties(
       const GetBlobPropertiesOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryGetProperties(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::GetBlobPropertiesResult> BlobClient::TryGetProperties(
+      const GetBlobPropertiesOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::BlobRestClient::Blob::GetBlobPropertiesOptions protocolLayerOptions;
     protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
@@ -476,8 +1031,14 @@ namespace Azure { namespace Storage { namespace Blobs {
       protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.GetValue().KeyHash;
       protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.GetValue().Algorithm;
     }
-    auto response = Details::BlobRestClient::Blob::GetProperties(
-        context, *m_pipeline, m_blobUrl, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    StorageResult<Models::GetBlobPropertiesResult> response(
+        Details::BlobRestClient::Blob::GetProperties(
+            context, *m_pipeline, m_blobUrl, protocolLayerOptions));
+    if (!response)
+    {
+      return response;
+    }
     if (response->Tier.HasValue() && !response->IsAccessTierInferred.HasValue())
     {
       response->IsAccessTierInferred = false;
@@ -626,6 +1187,13 @@ namespace Azure { namespace Storage { namespace Blobs {
   Azure::Core::Response<Models::DeleteBlobResult> BlobClient::Delete(
       const DeleteBlobOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryDelete(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::DeleteBlobResult> BlobClient::TryDelete(
+      const DeleteBlobOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::BlobRestClient::Blob::DeleteBlobOptions protocolLayerOptions;
     protocolLayerOptions.DeleteSnapshots = options.DeleteSnapshots;
@@ -635,31 +1203,29 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
     protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
     protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    return Details::BlobRestClient::Blob::Delete(
-        context, *m_pipeline, m_blobUrl, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    return StorageResult<Models::DeleteBlobResult>(Details::BlobRestClient::Blob::Delete(
+        context, *m_pipeline, m_blobUrl, protocolLayerOptions));
   }
 
   Azure::Core::Response<Models::DeleteBlobResult> BlobClient::DeleteIfExists(
       const DeleteBlobOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
-    {
-      return Delete(options, context);
-    }
-    catch (StorageException& e)
+    auto result = TryDelete(options, context);
+    if (!result && result.GetStatusCode() == Core::Http::HttpStatusCode::NotFound)
     {
-      if (e.StatusCode == Core::Http::HttpStatusCode::NotFound
-          && (e.ErrorCode == "BlobNotFound" || e.ErrorCode == "ContainerNotFound"))
+      auto errorCode = result.GetErrorCode();
+      if (errorCode == "BlobNotFound" || errorCode == "ContainerNotFound")
       {
         Models::DeleteBlobResult ret;
-        ret.RequestId = e.RequestId;
+        ret.RequestId = result.GetRequestId();
         ret.Deleted = false;
         return Azure::Core::Response<Models::DeleteBlobResult>(
-            std::move(ret), std::move(e.RawResponse));
+            std::move(ret), result.ExtractRawResponse());
       }
-      throw;
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::UndeleteBlobResult> BlobClient::Undelete(
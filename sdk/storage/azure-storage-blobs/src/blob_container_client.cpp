@@ -3,7 +3,18 @@
 
 #include "azure/storage/blobs/blob_container_client.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include <azure/core/http/policy.hpp>
+#include <azure/storage/common/concurrent_transfer.hpp>
 #include <azure/storage/common/constants.hpp>
 #include <azure/storage/common/shared_key_policy.hpp>
 #include <azure/storage/common/storage_common.hpp>
@@ -16,6 +27,358 @@
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    /*
+     * Lists the blobs under a set of disjoint prefixes with several requests in flight. Each
+     * prefix is a node whose pages are fetched one at a time, either by a worker on the transfer
+     * executor or by the calling thread, which also hands out the blobs. The directories found
+     * while a node is listed by hierarchy become its child nodes. A node's pages are kept in name
+     * order, with the child nodes in between, so walking the tree hands out the blobs in order.
+     */
+    class ParallelBlobLister {
+    public:
+      explicit ParallelBlobLister(
+          const BlobContainerClient& client,
+          const std::function<void(Models::BlobItem)>& onBlobItem,
+          const ListBlobsParallelOptions& options,
+          const Azure::Core::Context& context)
+          : m_client(client), m_onBlobItem(onBlobItem), m_options(options),
+            m_concurrency(std::max(options.Concurrency, 1)),
+            m_context(context.WithDeadline(Azure::Core::Context::time_point::max()))
+      {
+        std::vector<std::string> prefixes = options.Prefixes;
+        if (prefixes.empty())
+        {
+          prefixes.emplace_back();
+        }
+        std::sort(prefixes.begin(), prefixes.end());
+        for (std::size_t i = 1; i < prefixes.size(); ++i)
+        {
+          if (prefixes[i].compare(0, prefixes[i - 1].size(), prefixes[i - 1]) == 0)
+          {
+            throw std::invalid_argument("overlapping prefixes");
+          }
+        }
+        for (auto& prefix : prefixes)
+        {
+          Entry entry;
+          entry.Child = std::make_unique<Node>();
+          entry.Child->Prefix = std::move(prefix);
+          m_pending.emplace(entry.Child->Prefix, entry.Child.get());
+          m_root.Entries.push_back(std::move(entry));
+        }
+        m_root.Done = true;
+        m_cursor.emplace_back(&m_root, 0);
+      }
+
+      void Run()
+      {
+        std::vector<std::unique_ptr<Storage::Details::TransferTask>> workers;
+        std::exception_ptr error;
+        try
+        {
+          for (int i = 1; i < m_concurrency; ++i)
+          {
+            workers.push_back(
+                std::make_unique<Storage::Details::TransferTask>([this]() { Work(); }));
+          }
+
+          std::unique_lock<std::mutex> lock(m_mutex);
+          while (!m_error)
+          {
+            if (HandOutNext(lock))
+            {
+              continue;
+            }
+            if (IsFinished())
+            {
+              break;
+            }
+            if (!m_pending.empty())
+            {
+              // the calling thread ignores the buffer limit, so the pages it waits for arrive
+              ListNextPage(lock);
+            }
+            else
+            {
+              m_cv.wait(lock);
+            }
+          }
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+
+        {
+          std::lock_guard<std::mutex> guard(m_mutex);
+          m_stopped = true;
+        }
+        m_context.Cancel();
+        m_cv.notify_all();
+        workers.clear();
+
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+        if (m_error)
+        {
+          std::rethrow_exception(m_error);
+        }
+      }
+
+    private:
+      struct Node;
+
+      // either a run of blobs or a directory
+      struct Entry
+      {
+        std::vector<Models::BlobItem> Items;
+        std::unique_ptr<Node> Child;
+      };
+
+      struct Node
+      {
+        std::string Prefix;
+        int Depth = 0;
+        Azure::Core::Nullable<std::string> ContinuationToken;
+        bool Done = false;
+        // in name order, the blobs are only kept here when they're handed out in order
+        std::vector<Entry> Entries;
+      };
+
+      struct Page
+      {
+        std::vector<Entry> Entries;
+        Azure::Core::Nullable<std::string> ContinuationToken;
+      };
+
+      Page ListPage(const Node& node) const
+      {
+        ListBlobsSinglePageOptions pageOptions;
+        if (!node.Prefix.empty())
+        {
+          pageOptions.Prefix = node.Prefix;
+        }
+        pageOptions.ContinuationToken = node.ContinuationToken;
+        pageOptions.PageSizeHint = m_options.PageSizeHint;
+        pageOptions.Include = m_options.Include;
+
+        Page page;
+        if (node.Depth < m_options.SplitDepth && !m_options.Delimiter.empty())
+        {
+          auto response = m_client.ListBlobsByHierarchySinglePage(
+              m_options.Delimiter, pageOptions, m_context);
+          page.ContinuationToken = std::move(response->ContinuationToken);
+          // both are sorted by name
+          auto item = response->Items.begin();
+          auto addItemsBefore = [&](const std::string* name) {
+            Entry entry;
+            for (; item != response->Items.end() && (!name || item->Name < *name); ++item)
+            {
+              entry.Items.push_back(std::move(*item));
+            }
+            if (!entry.Items.empty())
+            {
+              page.Entries.push_back(std::move(entry));
+            }
+          };
+          for (auto& prefix : response->BlobPrefixes)
+          {
+            addItemsBefore(&prefix);
+            Entry entry;
+            entry.Child = std::make_unique<Node>();
+            entry.Child->Prefix = std::move(prefix);
+            entry.Child->Depth = node.Depth + 1;
+            page.Entries.push_back(std::move(entry));
+          }
+          addItemsBefore(nullptr);
+        }
+        else
+        {
+          auto response = m_client.ListBlobsSinglePage(pageOptions, m_context);
+          page.ContinuationToken = std::move(response->ContinuationToken);
+          Entry entry;
+          entry.Items = std::move(response->Items);
+          page.Entries.push_back(std::move(entry));
+        }
+        return page;
+      }
+
+      // Takes the first pending node and lists its next page. Called with the lock held.
+      void ListNextPage(std::unique_lock<std::mutex>& lock)
+      {
+        Node& node = *m_pending.begin()->second;
+        m_pending.erase(m_pending.begin());
+        ++m_numInFlight;
+        lock.unlock();
+
+        Page page;
+        std::exception_ptr error;
+        try
+        {
+          page = ListPage(node);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+
+        lock.lock();
+        --m_numInFlight;
+        if (error)
+        {
+          if (!m_error)
+          {
+            m_error = error;
+          }
+        }
+        else
+        {
+          for (auto& entry : page.Entries)
+          {
+            if (entry.Child)
+            {
+              m_pending.emplace(entry.Child->Prefix, entry.Child.get());
+            }
+            else
+            {
+              ++m_numBufferedPages;
+              if (!m_options.Ordered)
+              {
+                m_ready.push_back(std::move(entry.Items));
+                continue;
+              }
+            }
+            node.Entries.push_back(std::move(entry));
+          }
+          node.ContinuationToken = std::move(page.ContinuationToken);
+          if (node.ContinuationToken.HasValue() && !node.ContinuationToken.GetValue().empty())
+          {
+            m_pending.emplace(node.Prefix, &node);
+          }
+          else
+          {
+            node.Done = true;
+          }
+        }
+        m_cv.notify_all();
+      }
+
+      void Work()
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        const std::size_t maxBufferedPages = static_cast<std::size_t>(m_concurrency) * 4;
+        while (!m_stopped && !m_error)
+        {
+          if (!m_pending.empty() && m_numBufferedPages < maxBufferedPages)
+          {
+            ListNextPage(lock);
+          }
+          else if (m_pending.empty() && m_numInFlight == 0)
+          {
+            return;
+          }
+          else
+          {
+            m_cv.wait(lock);
+          }
+        }
+      }
+
+      // Hands out the next run of blobs if it has arrived. Called with the lock held.
+      bool HandOutNext(std::unique_lock<std::mutex>& lock)
+      {
+        std::vector<Models::BlobItem> items;
+        if (m_options.Ordered)
+        {
+          while (!m_cursor.empty() && items.empty())
+          {
+            Node& node = *m_cursor.back().first;
+            std::size_t& index = m_cursor.back().second;
+            if (index < node.Entries.size())
+            {
+              Entry& entry = node.Entries[index++];
+              if (entry.Child)
+              {
+                m_cursor.emplace_back(entry.Child.get(), 0);
+                continue;
+              }
+              items = std::move(entry.Items);
+              entry.Items.clear();
+              if (items.empty())
+              {
+                --m_numBufferedPages;
+              }
+            }
+            else if (node.Done)
+            {
+              // the children have all been handed out by now
+              node.Entries.clear();
+              m_cursor.pop_back();
+            }
+            else
+            {
+              return false;
+            }
+          }
+          if (items.empty())
+          {
+            return false;
+          }
+        }
+        else
+        {
+          if (m_ready.empty())
+          {
+            return false;
+          }
+          items = std::move(m_ready.front());
+          m_ready.pop_front();
+        }
+        --m_numBufferedPages;
+        m_cv.notify_all();
+
+        lock.unlock();
+        for (auto& item : items)
+        {
+          m_onBlobItem(std::move(item));
+        }
+        lock.lock();
+        return true;
+      }
+
+      bool IsFinished() const
+      {
+        if (m_options.Ordered)
+        {
+          return m_cursor.empty();
+        }
+        return m_ready.empty() && m_pending.empty() && m_numInFlight == 0;
+      }
+
+      const BlobContainerClient& m_client;
+      const std::function<void(Models::BlobItem)>& m_onBlobItem;
+      const ListBlobsParallelOptions& m_options;
+      const int m_concurrency;
+      Azure::Core::Context m_context;
+      // the prefixes to list
+      Node m_root;
+
+      std::mutex m_mutex;
+      std::condition_variable m_cv;
+      // protected by m_mutex
+      std::map<std::string, Node*> m_pending;
+      std::size_t m_numInFlight = 0;
+      std::size_t m_numBufferedPages = 0;
+      std::deque<std::vector<Models::BlobItem>> m_ready;
+      std::vector<std::pair<Node*, std::size_t>> m_cursor;
+      std::exception_ptr m_error;
+      bool m_stopped = false;
+    };
+  } // namespace
+
   BlobContainerClient BlobContainerClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -149,83 +512,98 @@ namespace Azure { namespace Storage { namespace Blobs {
   Azure::Core::Response<Models::CreateBlobContainerResult> BlobContainerClient::Create(
       const CreateBlobContainerOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryCreate(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::CreateBlobContainerResult> BlobContainerClient::TryCreate(
+      const CreateBlobContainerOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::BlobRestClient::BlobContainer::CreateBlobContainerOptions protocolLayerOptions;
     protocolLayerOptions.AccessType = options.AccessType;
     protocolLayerOptions.Metadata = options.Metadata;
     protocolLayerOptions.DefaultEncryptionScope = options.DefaultEncryptionScope;
     protocolLayerOptions.PreventEncryptionScopeOverride = options.PreventEncryptionScopeOverride;
-    return Details::BlobRestClient::BlobContainer::Create(
-        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    return StorageResult<Models::CreateBlobContainerResult>(
+        Details::BlobRestClient::BlobContainer::Create(
+            context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions));
   }
 
   Azure::Core::Response<Models::CreateBlobContainerResult> BlobContainerClient::CreateIfNotExists(
       const CreateBlobContainerOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
+    auto result = TryCreate(options, context);
+    if (!result && result.GetStatusCode() == Core::Http::HttpStatusCode::Conflict
+        && result.GetErrorCode() == "ContainerAlreadyExists")
     {
-      return Create(options, context);
-    }
-    catch (StorageException& e)
-    {
-      if (e.StatusCode == Core::Http::HttpStatusCode::Conflict
-          && e.ErrorCode == "ContainerAlreadyExists")
-      {
-        Models::CreateBlobContainerResult ret;
-        ret.RequestId = e.RequestId;
-        ret.Created = false;
-        return Azure::Core::Response<Models::CreateBlobContainerResult>(
-            std::move(ret), std::move(e.RawResponse));
-      }
-      throw;
+      Models::CreateBlobContainerResult ret;
+      ret.RequestId = result.GetRequestId();
+      ret.Created = false;
+      return Azure::Core::Response<Models::CreateBlobContainerResult>(
+          std::move(ret), result.ExtractRawResponse());
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::DeleteBlobContainerResult> BlobContainerClient::Delete(
       const DeleteBlobContainerOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryDelete(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::DeleteBlobContainerResult> BlobContainerClient::TryDelete(
+      const DeleteBlobContainerOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::BlobRestClient::BlobContainer::DeleteBlobContainerOptions protocolLayerOptions;
     protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
     protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
     protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
-    return Details::BlobRestClient::BlobContainer::Delete(
-        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    return StorageResult<Models::DeleteBlobContainerResult>(
+        Details::BlobRestClient::BlobContainer::Delete(
+            context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions));
   }
 
   Azure::Core::Response<Models::DeleteBlobContainerResult> BlobContainerClient::DeleteIfExists(
       const DeleteBlobContainerOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
-    {
-      return Delete(options, context);
-    }
-    catch (StorageException& e)
+    auto result = TryDelete(options, context);
+    if (!result && result.GetStatusCode() == Core::Http::HttpStatusCode::NotFound
+        && result.GetErrorCode() == "ContainerNotFound")
     {
-      if (e.StatusCode == Core::Http::HttpStatusCode::NotFound
-          && e.ErrorCode == "ContainerNotFound")
-      {
-        Models::DeleteBlobContainerResult ret;
-        ret.RequestId = e.RequestId;
-        ret.Deleted = false;
-        return Azure::Core::Response<Models::DeleteBlobContainerResult>(
-            std::move(ret), std::move(e.RawResponse));
-      }
-      throw;
+      Models::DeleteBlobContainerResult ret;
+      ret.RequestId = result.GetRequestId();
+      ret.Deleted = false;
+      return Azure::Core::Response<Models::DeleteBlobContainerResult>(
+          std::move(ret), result.ExtractRawResponse());
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::GetBlobContainerPropertiesResult>
   BlobContainerClient::GetProperties(
       const GetBlobContainerPropertiesOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryGetProperties(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::GetBlobContainerPropertiesResult> BlobContainerClient::TryGetProperties(
+      const GetBlobContainerPropertiesOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::BlobRestClient::BlobContainer::GetBlobContainerPropertiesOptions protocolLayerOptions;
     protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    return Details::BlobRestClient::BlobContainer::GetProperties(
-        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    return StorageResult<Models::GetBlobContainerPropertiesResult>(
+        Details::BlobRestClient::BlobContainer::GetProperties(
+            context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions));
   }
 
   Azure::Core::Response<Models::SetBlobContainerMetadataResult> BlobContainerClient::SetMetadata(
@@ -250,10 +628,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.ContinuationToken = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
-    auto response = Details::BlobRestClient::BlobContainer::ListBlobsSinglePage(
-        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
-    for (auto& i : response->Items)
-    {
+    auto fillDefaults = [](Models::BlobItem& i) {
       if (i.Details.Tier.HasValue() && !i.Details.IsAccessTierInferred.HasValue())
       {
         i.Details.IsAccessTierInferred = false;
@@ -266,10 +641,55 @@ namespace Azure { namespace Storage { namespace Blobs {
       {
         i.Details.IsSealed = false;
       }
+    };
+    if (options.OnBlobItem)
+    {
+      protocolLayerOptions.OnBlobItem = [&options, &fillDefaults](Models::BlobItem item) {
+        fillDefaults(item);
+        options.OnBlobItem(std::move(item));
+      };
+    }
+    auto response = Details::BlobRestClient::BlobContainer::ListBlobsSinglePage(
+        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
+    for (auto& i : response->Items)
+    {
+      fillDefaults(i);
     }
     return response;
   }
 
+  Pager<Models::ListBlobsSinglePageResult> BlobContainerClient::ListBlobs(
+      const ListBlobsSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListBlobsSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListBlobsSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
+  Azure::Core::Response<Models::ListBlobsCompactSinglePageResult>
+  BlobContainerClient::ListBlobsCompactSinglePage(
+      const ListBlobsSinglePageOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    Details::BlobRestClient::BlobContainer::ListBlobsSinglePageOptions protocolLayerOptions;
+    protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    protocolLayerOptions.MaxResults = options.PageSizeHint;
+    protocolLayerOptions.Include = options.Include;
+    return Details::BlobRestClient::BlobContainer::ListBlobsCompactSinglePage(
+        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
+  }
+
   Azure::Core::Response<Models::ListBlobsByHierarchySinglePageResult>
   BlobContainerClient::ListBlobsByHierarchySinglePage(
       const std::string& delimiter,
@@ -283,18 +703,55 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.ContinuationToken = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
-    auto response = Details::BlobRestClient::BlobContainer::ListBlobsByHierarchySinglePage(
-        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
-    for (auto& i : response->Items)
-    {
+    auto fillDefaults = [](Models::BlobItem& i) {
       if (i.VersionId.HasValue() && !i.IsCurrentVersion.HasValue())
       {
         i.IsCurrentVersion = false;
       }
+    };
+    if (options.OnBlobItem)
+    {
+      protocolLayerOptions.OnBlobItem = [&options, &fillDefaults](Models::BlobItem item) {
+        fillDefaults(item);
+        options.OnBlobItem(std::move(item));
+      };
+    }
+    auto response = Details::BlobRestClient::BlobContainer::ListBlobsByHierarchySinglePage(
+        context, *m_pipeline, m_blobContainerUrl, protocolLayerOptions);
+    for (auto& i : response->Items)
+    {
+      fillDefaults(i);
     }
     return response;
   }
 
+  Pager<Models::ListBlobsByHierarchySinglePageResult> BlobContainerClient::ListBlobsByHierarchy(
+      const std::string& delimiter,
+      const ListBlobsSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListBlobsByHierarchySinglePageResult>(
+        [client = *this, delimiter, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListBlobsByHierarchySinglePage(delimiter, pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
+  void BlobContainerClient::ListBlobsParallel(
+      const std::function<void(Models::BlobItem)>& onBlobItem,
+      const ListBlobsParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    ParallelBlobLister(*this, onBlobItem, options, context).Run();
+  }
+
   Azure::Core::Response<Models::GetBlobContainerAccessPolicyResult>
   BlobContainerClient::GetAccessPolicy(
       const GetBlobContainerAccessPolicyOptions& options,
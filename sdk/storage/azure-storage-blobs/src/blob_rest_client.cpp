@@ -93,4 +93,40 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Models {
   const SkuName SkuName::StandardGzrs("Standard_GZRS");
   const SkuName SkuName::StandardRagzrs("Standard_RAGZRS");
 
+  BlobItem CompactBlobItemList::GetBlobItem(std::size_t index) const
+  {
+    std::string xml
+        = "<Blob>" + m_sharedProperties.Get(m_sharedPropertiesIndex[index]) + "</Blob>";
+    Storage::Details::XmlReader reader(xml.data(), xml.length());
+    reader.Read();
+    BlobItem ret = Blobs::Details::BlobRestClient::BlobContainer::BlobItemFromXml(reader);
+    ret.Name = GetName(index);
+    ret.BlobSize = GetBlobSize(index);
+    ret.IsDeleted = IsDeleted(index);
+    ret.Snapshot = GetSnapshot(index);
+    ret.VersionId = GetVersionId(index);
+    ret.Details.CreatedOn = GetCreatedOn(index);
+    ret.Details.LastModified = GetLastModified(index);
+    ret.Details.ETag = GetETag(index);
+    std::string contentMd5 = m_contentMd5s.Get(index);
+    if (!contentMd5.empty())
+    {
+      ret.Details.HttpHeaders.ContentHash.Value = Azure::Core::Base64Decode(contentMd5);
+    }
+    // same defaults as BlobContainerClient::ListBlobsSinglePage fills in
+    if (ret.Details.Tier.HasValue() && !ret.Details.IsAccessTierInferred.HasValue())
+    {
+      ret.Details.IsAccessTierInferred = false;
+    }
+    if (ret.VersionId.HasValue() && !ret.IsCurrentVersion.HasValue())
+    {
+      ret.IsCurrentVersion = false;
+    }
+    if (ret.BlobType == BlobType::AppendBlob && !ret.Details.IsSealed.HasValue())
+    {
+      ret.Details.IsSealed = false;
+    }
+    return ret;
+  }
+
 }}}} // namespace Azure::Storage::Blobs::Models
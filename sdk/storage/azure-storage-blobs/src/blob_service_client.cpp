@@ -141,6 +141,24 @@ namespace Azure { namespace Storage { namespace Blobs {
         context, *m_pipeline, m_serviceUrl, protocolLayerOptions);
   }
 
+  Pager<Models::ListBlobContainersSinglePageResult> BlobServiceClient::ListBlobContainers(
+      const ListBlobContainersSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListBlobContainersSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListBlobContainersSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
   Azure::Core::Response<Models::GetUserDelegationKeyResult> BlobServiceClient::GetUserDelegationKey(
       const Azure::Core::DateTime& expiresOn,
       const GetUserDelegationKeyOptions& options,
@@ -209,6 +227,25 @@ namespace Azure { namespace Storage { namespace Blobs {
         context, *m_pipeline, m_serviceUrl, protocolLayerOptions);
   }
 
+  Pager<Models::FindBlobsByTagsSinglePageResult> BlobServiceClient::FindBlobsByTags(
+      const std::string& tagFilterSqlExpression,
+      const FindBlobsByTagsSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::FindBlobsByTagsSinglePageResult>(
+        [client = *this, tagFilterSqlExpression, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.FindBlobsByTagsSinglePage(tagFilterSqlExpression, pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
   Azure::Core::Response<BlobContainerClient> BlobServiceClient::CreateBlobContainer(
       const std::string& blobContainerName,
       const CreateBlobContainerOptions& options,
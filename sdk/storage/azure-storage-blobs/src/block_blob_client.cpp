@@ -11,6 +11,42 @@
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // The transactional hash of a block. The CRC64 is kept in crc64 so that the hashes of all
+    // blocks can be concatenated into the hash of the whole blob.
+    ContentHash HashBlock(
+        HashAlgorithm algorithm,
+        const uint8_t* data,
+        std::size_t length,
+        Crc64Hash& crc64)
+    {
+      ContentHash hash;
+      hash.Algorithm = algorithm;
+      if (algorithm == HashAlgorithm::Crc64)
+      {
+        hash.Value = crc64.Final(data, length);
+      }
+      else
+      {
+        hash.Value = Azure::Core::Cryptography::Md5Hash().Final(data, length);
+      }
+      return hash;
+    }
+
+    ContentHash ConcatenateBlockCrc64s(const std::vector<Crc64Hash>& blockCrc64s)
+    {
+      Crc64Hash crc64;
+      for (const auto& blockCrc64 : blockCrc64s)
+      {
+        crc64.Concatenate(blockCrc64);
+      }
+      ContentHash hash;
+      hash.Algorithm = HashAlgorithm::Crc64;
+      hash.Value = crc64.Final();
+      return hash;
+    }
+  } // namespace
+
   BlockBlobClient BlockBlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -120,6 +156,12 @@ namespace Azure { namespace Storage { namespace Blobs {
       uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
       uploadBlockBlobOptions.Metadata = options.Metadata;
       uploadBlockBlobOptions.Tier = options.Tier;
+      if (options.TransactionalHashAlgorithm.HasValue())
+      {
+        Crc64Hash crc64;
+        uploadBlockBlobOptions.TransactionalContentHash = HashBlock(
+            options.TransactionalHashAlgorithm.GetValue(), buffer, bufferSize, crc64);
+      }
       return Upload(&contentStream, uploadBlockBlobOptions, context);
     }
 
@@ -128,12 +170,28 @@ namespace Azure { namespace Storage { namespace Blobs {
       constexpr std::size_t BlockIdLength = 64;
       std::string blockId = std::to_string(id);
       blockId = std::string(BlockIdLength - blockId.length(), '0') + blockId;
-      return Azure::Core::Base64Encode(std::vector<uint8_t>(blockId.begin(), blockId.end()));
+      return Azure::Core::Base64Encode(
+          reinterpret_cast<const uint8_t*>(blockId.data()), blockId.length());
     };
 
+    const bool crc64Enabled = options.TransactionalHashAlgorithm.HasValue()
+        && options.TransactionalHashAlgorithm.GetValue() == HashAlgorithm::Crc64;
+    const std::size_t numBlocks
+        = static_cast<std::size_t>((static_cast<int64_t>(bufferSize) + chunkSize - 1) / chunkSize);
+    std::vector<Crc64Hash> blockCrc64s(crc64Enabled ? numBlocks : 0);
+
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       Azure::Core::Http::MemoryBodyStream contentStream(buffer + offset, length);
       StageBlockOptions chunkOptions;
+      if (options.TransactionalHashAlgorithm.HasValue())
+      {
+        Crc64Hash blockCrc64;
+        chunkOptions.TransactionalContentHash = HashBlock(
+            options.TransactionalHashAlgorithm.GetValue(),
+            buffer + offset,
+            static_cast<std::size_t>(length),
+            crc64Enabled ? blockCrc64s[static_cast<std::size_t>(chunkId)] : blockCrc64);
+      }
       auto blockInfo = StageBlock(getBlockId(chunkId), &contentStream, chunkOptions, context);
       if (chunkId == numChunks - 1)
       {
@@ -142,7 +200,12 @@ namespace Azure { namespace Storage { namespace Blobs {
     };
 
     Storage::Details::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadBlockFunc);
+        0,
+        bufferSize,
+        chunkSize,
+        options.TransferOptions.Concurrency,
+        uploadBlockFunc,
+        context);
 
     for (std::size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -161,6 +224,10 @@ namespace Azure { namespace Storage { namespace Blobs {
     ret.IsServerEncrypted = commitBlockListResponse->IsServerEncrypted;
     ret.EncryptionKeySha256 = std::move(commitBlockListResponse->EncryptionKeySha256);
     ret.EncryptionScope = std::move(commitBlockListResponse->EncryptionScope);
+    if (crc64Enabled)
+    {
+      ret.TransactionalContentHash = ConcatenateBlockCrc64s(blockCrc64s);
+    }
     return Azure::Core::Response<Models::UploadBlockBlobFromResult>(
         std::move(ret), commitBlockListResponse.ExtractRawResponse());
   }
@@ -176,14 +243,36 @@ namespace Azure { namespace Storage { namespace Blobs {
 
     int64_t chunkSize = std::min(MaxStageBlockSize, options.TransferOptions.ChunkSize);
 
+    // With a transactional hash, the content of each request is read into memory once, hashed and
+    // sent from there.
+    auto readBlock = [&](int64_t offset, int64_t length) {
+      Azure::Core::Http::FileBodyStream fileStream(fileReader.GetHandle(), offset, length);
+      std::vector<uint8_t> block(static_cast<std::size_t>(length));
+      if (Azure::Core::Http::BodyStream::ReadToCount(context, fileStream, block.data(), length)
+          != length)
+      {
+        throw std::runtime_error("failed to read file");
+      }
+      return block;
+    };
+
     if (fileReader.GetFileSize() <= options.TransferOptions.SingleUploadThreshold)
     {
-      Azure::Core::Http::FileBodyStream contentStream(
-          fileReader.GetHandle(), 0, fileReader.GetFileSize());
       UploadBlockBlobOptions uploadBlockBlobOptions;
       uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
       uploadBlockBlobOptions.Metadata = options.Metadata;
       uploadBlockBlobOptions.Tier = options.Tier;
+      if (options.TransactionalHashAlgorithm.HasValue())
+      {
+        auto content = readBlock(0, fileReader.GetFileSize());
+        Crc64Hash crc64;
+        uploadBlockBlobOptions.TransactionalContentHash = HashBlock(
+            options.TransactionalHashAlgorithm.GetValue(), content.data(), content.size(), crc64);
+        Azure::Core::Http::MemoryBodyStream contentStream(content);
+        return Upload(&contentStream, uploadBlockBlobOptions, context);
+      }
+      Azure::Core::Http::FileBodyStream contentStream(
+          fileReader.GetHandle(), 0, fileReader.GetFileSize());
       return Upload(&contentStream, uploadBlockBlobOptions, context);
     }
 
@@ -192,13 +281,35 @@ namespace Azure { namespace Storage { namespace Blobs {
       constexpr std::size_t BlockIdLength = 64;
       std::string blockId = std::to_string(id);
       blockId = std::string(BlockIdLength - blockId.length(), '0') + blockId;
-      return Azure::Core::Base64Encode(std::vector<uint8_t>(blockId.begin(), blockId.end()));
+      return Azure::Core::Base64Encode(
+          reinterpret_cast<const uint8_t*>(blockId.data()), blockId.length());
     };
 
+    const bool crc64Enabled = options.TransactionalHashAlgorithm.HasValue()
+        && options.TransactionalHashAlgorithm.GetValue() == HashAlgorithm::Crc64;
+    const std::size_t numBlocks
+        = static_cast<std::size_t>((fileReader.GetFileSize() + chunkSize - 1) / chunkSize);
+    std::vector<Crc64Hash> blockCrc64s(crc64Enabled ? numBlocks : 0);
+
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      Azure::Core::Http::FileBodyStream contentStream(fileReader.GetHandle(), offset, length);
       StageBlockOptions chunkOptions;
-      auto blockInfo = StageBlock(getBlockId(chunkId), &contentStream, chunkOptions, context);
+      if (options.TransactionalHashAlgorithm.HasValue())
+      {
+        auto block = readBlock(offset, length);
+        Crc64Hash blockCrc64;
+        chunkOptions.TransactionalContentHash = HashBlock(
+            options.TransactionalHashAlgorithm.GetValue(),
+            block.data(),
+            block.size(),
+            crc64Enabled ? blockCrc64s[static_cast<std::size_t>(chunkId)] : blockCrc64);
+        Azure::Core::Http::MemoryBodyStream contentStream(block);
+        StageBlock(getBlockId(chunkId), &contentStream, chunkOptions, context);
+      }
+      else
+      {
+        Azure::Core::Http::FileBodyStream contentStream(fileReader.GetHandle(), offset, length);
+        StageBlock(getBlockId(chunkId), &contentStream, chunkOptions, context);
+      }
       if (chunkId == numChunks - 1)
       {
         blockIds.resize(static_cast<std::size_t>(numChunks));
@@ -210,7 +321,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         fileReader.GetFileSize(),
         chunkSize,
         options.TransferOptions.Concurrency,
-        uploadBlockFunc);
+        uploadBlockFunc,
+        context);
 
     for (std::size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -229,6 +341,10 @@ namespace Azure { namespace Storage { namespace Blobs {
     result.IsServerEncrypted = commitBlockListResponse->IsServerEncrypted;
     result.EncryptionKeySha256 = commitBlockListResponse->EncryptionKeySha256;
     result.EncryptionScope = commitBlockListResponse->EncryptionScope;
+    if (crc64Enabled)
+    {
+      result.TransactionalContentHash = ConcatenateBlockCrc64s(blockCrc64s);
+    }
     return Azure::Core::Response<Models::UploadBlockBlobFromResult>(
         std::move(result), commitBlockListResponse.ExtractRawResponse());
   }
@@ -3,8 +3,12 @@
 
 #include "blob_container_client_test.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <set>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <azure/storage/blobs/blob_lease_client.hpp>
 #include <azure/storage/blobs/blob_sas_builder.hpp>
@@ -234,6 +238,54 @@ namespace Azure { namespace Storage { namespace Test {
       }
     } while (options.ContinuationToken.HasValue());
     EXPECT_TRUE(std::includes(listBlobs.begin(), listBlobs.end(), p1Blobs.begin(), p1Blobs.end()));
+
+    // blobs handed to the callback while the response is being received
+    listBlobs.clear();
+    options.OnBlobItem = [&listBlobs](Blobs::Models::BlobItem blob) {
+      EXPECT_TRUE(blob.Details.IsAccessTierInferred.HasValue());
+      listBlobs.insert(std::move(blob.Name));
+    };
+    do
+    {
+      auto res = m_blobContainerClient->ListBlobsSinglePage(options);
+      EXPECT_FALSE(res->RequestId.empty());
+      EXPECT_TRUE(res->Items.empty());
+      options.ContinuationToken = res->ContinuationToken;
+    } while (options.ContinuationToken.HasValue());
+    EXPECT_EQ(listBlobs, p1Blobs);
+
+    listBlobs.clear();
+    options.OnBlobItem = nullptr;
+    do
+    {
+      auto res = m_blobContainerClient->ListBlobsCompactSinglePage(options);
+      EXPECT_FALSE(res->RequestId.empty());
+      for (std::size_t i = 0; i < res->Items.Size(); ++i)
+      {
+        EXPECT_TRUE(res->Items.GetBlobItem(i).Details.IsAccessTierInferred.HasValue());
+        listBlobs.insert(res->Items.GetName(i));
+      }
+      options.ContinuationToken = res->ContinuationToken;
+    } while (options.ContinuationToken.HasValue());
+    EXPECT_EQ(listBlobs, p1Blobs);
+
+    for (int prefetchPages : {0, 2})
+    {
+      listBlobs.clear();
+      options.ContinuationToken.Reset();
+      PagerOptions pagerOptions;
+      pagerOptions.PrefetchPages = prefetchPages;
+      auto pager = m_blobContainerClient->ListBlobs(options, pagerOptions);
+      while (pager.NextPage())
+      {
+        EXPECT_FALSE(pager.CurrentPage()->RequestId.empty());
+        for (const auto& blob : pager.CurrentPage()->Items)
+        {
+          listBlobs.insert(blob.Name);
+        }
+      }
+      EXPECT_EQ(listBlobs, p1Blobs);
+    }
   }
 
   TEST_F(BlobContainerClientTest, ListBlobsHierarchy)
@@ -1119,4 +1171,314 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_THROW(blobClient.GetProperties(), StorageException);
   }
 
+  TEST(ListBlobsCompactTest, SameAsBlobItems)
+  {
+    std::string xml
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?><EnumerationResults "
+          "ServiceEndpoint=\"https://a.blob.core.windows.net/\" ContainerName=\"c\">"
+          "<Prefix>p</Prefix><Blobs>";
+    for (int i = 0; i < 50; ++i)
+    {
+      std::string n = std::to_string(i);
+      xml += "<Blob><Name>p" + n + "&amp;&lt;\r</Name>";
+      if (i % 7 == 0)
+      {
+        xml += "<Deleted>true</Deleted><Snapshot>2021-02-18T08:00:0" + std::to_string(i % 10)
+            + ".0000000Z</Snapshot>";
+      }
+      if (i % 3 == 0)
+      {
+        xml += "<VersionId>2021-02-18T08:00:00." + n + "Z</VersionId>";
+        xml += i % 2 == 0 ? "<IsCurrentVersion>true</IsCurrentVersion>" : "";
+      }
+      xml += "<Properties><Creation-Time>Thu, 18 Feb 2021 08:00:" + std::to_string(10 + i % 50)
+          + " GMT</Creation-Time><Last-Modified>Fri, 19 Feb 2021 08:00:00 GMT</Last-Modified>"
+            "<Etag>0x8D8D3F1E2A3B4"
+          + n + "</Etag><Content-Length>" + std::to_string(i * 1000) + "</Content-Length>"
+          + "<Content-Type>" + (i % 2 == 0 ? "text/plain" : "a&amp;b") + "</Content-Type>"
+          + "<Content-Encoding /><Content-MD5>" + (i % 5 == 0 ? "" : "1B2M2Y8AsgTpgAmY7PhCfg==")
+          + "</Content-MD5><BlobType>" + (i % 4 == 0 ? "AppendBlob" : "BlockBlob")
+          + "</BlobType>" + (i % 2 == 0 ? "<AccessTier>Hot</AccessTier>" : "")
+          + "<LeaseStatus>unlocked</LeaseStatus><LeaseState>available</LeaseState>"
+            "<ServerEncrypted>true</ServerEncrypted></Properties>";
+      if (i % 10 == 0)
+      {
+        xml += "<Metadata><Name>in metadata</Name><k" + n + ">v\"&gt;\t</k" + n + "></Metadata>";
+      }
+      xml += "<OrMetadata /></Blob>";
+    }
+    xml += "</Blobs><NextMarker>m</NextMarker></EnumerationResults>";
+
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.TransportPolicyOptions.Transport
+        = std::make_shared<CannedResponseTransport>(xml);
+    Blobs::BlobContainerClient containerClient(
+        "https://a.blob.core.windows.net/c", clientOptions);
+    Blobs::ListBlobsSinglePageOptions options;
+    options.Include = Blobs::Models::ListBlobsIncludeFlags::Metadata;
+    auto expected = containerClient.ListBlobsSinglePage(options);
+    auto compact = containerClient.ListBlobsCompactSinglePage(options);
+
+    EXPECT_EQ(compact->RequestId, expected->RequestId);
+    EXPECT_EQ(compact->ServiceEndpoint, expected->ServiceEndpoint);
+    EXPECT_EQ(compact->BlobContainerName, expected->BlobContainerName);
+    EXPECT_EQ(compact->Prefix, expected->Prefix);
+    EXPECT_EQ(compact->ContinuationToken.GetValue(), expected->ContinuationToken.GetValue());
+    ASSERT_EQ(compact->Items.Size(), expected->Items.size());
+    for (std::size_t i = 0; i < expected->Items.size(); ++i)
+    {
+      const auto& lhs = expected->Items[i];
+      auto rhs = compact->Items.GetBlobItem(i);
+      EXPECT_EQ(compact->Items.GetName(i), lhs.Name);
+      EXPECT_EQ(rhs.Name, lhs.Name);
+      EXPECT_EQ(rhs.BlobSize, lhs.BlobSize);
+      EXPECT_EQ(rhs.BlobType, lhs.BlobType);
+      EXPECT_EQ(rhs.IsDeleted, lhs.IsDeleted);
+      EXPECT_EQ(rhs.Snapshot, lhs.Snapshot);
+      EXPECT_EQ(rhs.VersionId.HasValue(), lhs.VersionId.HasValue());
+      EXPECT_EQ(rhs.VersionId.ValueOr(""), lhs.VersionId.ValueOr(""));
+      EXPECT_EQ(rhs.IsCurrentVersion.HasValue(), lhs.IsCurrentVersion.HasValue());
+      EXPECT_EQ(rhs.IsCurrentVersion.ValueOr(false), lhs.IsCurrentVersion.ValueOr(false));
+      EXPECT_EQ(rhs.Details.HttpHeaders.ContentType, lhs.Details.HttpHeaders.ContentType);
+      EXPECT_EQ(
+          rhs.Details.HttpHeaders.ContentHash.Value, lhs.Details.HttpHeaders.ContentHash.Value);
+      EXPECT_EQ(rhs.Details.Metadata, lhs.Details.Metadata);
+      EXPECT_EQ(rhs.Details.CreatedOn, lhs.Details.CreatedOn);
+      EXPECT_EQ(rhs.Details.LastModified, lhs.Details.LastModified);
+      EXPECT_EQ(rhs.Details.ETag, lhs.Details.ETag);
+      EXPECT_EQ(rhs.Details.Tier.HasValue(), lhs.Details.Tier.HasValue());
+      EXPECT_EQ(
+          rhs.Details.IsAccessTierInferred.HasValue(), lhs.Details.IsAccessTierInferred.HasValue());
+      EXPECT_EQ(rhs.Details.IsSealed.HasValue(), lhs.Details.IsSealed.HasValue());
+      EXPECT_EQ(rhs.Details.LeaseState, lhs.Details.LeaseState);
+      EXPECT_EQ(rhs.Details.IsServerEncrypted, lhs.Details.IsServerEncrypted);
+    }
+  }
+
+  namespace {
+    // answers list requests from a set of blob names, like the service would
+    class FakeListingTransport : public CannedResponseTransport {
+    public:
+      explicit FakeListingTransport(std::set<std::string> names) : m_names(std::move(names)) {}
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Context const&,
+          Azure::Core::Http::Request& request) override
+      {
+        ++NumRequests;
+        const auto& query = request.GetUrl().GetQueryParameters();
+        auto parameter = [&query](const std::string& name) {
+          auto i = query.find(name);
+          return i == query.end() ? std::string() : Azure::Core::Http::Url::Decode(i->second);
+        };
+        const std::string prefix = parameter("prefix");
+        const std::string delimiter = parameter("delimiter");
+        const std::string maxResults = parameter("maxresults");
+        const std::size_t pageSize
+            = maxResults.empty() ? 5000 : static_cast<std::size_t>(std::stoi(maxResults));
+
+        std::string body = "<?xml version=\"1.0\" encoding=\"utf-8\"?><EnumerationResults "
+                           "ServiceEndpoint=\"https://a.blob.core.windows.net/\" "
+                           "ContainerName=\"c\"><Prefix>"
+            + prefix + "</Prefix><Blobs>";
+        std::size_t numResults = 0;
+        auto name = m_names.lower_bound(std::max(prefix, parameter("marker")));
+        while (name != m_names.end() && name->compare(0, prefix.size(), prefix) == 0)
+        {
+          if (numResults == pageSize)
+          {
+            body += "</Blobs><NextMarker>" + *name + "</NextMarker></EnumerationResults>";
+            return MakeResponse(
+                Azure::Core::Http::HttpStatusCode::Ok,
+                std::vector<uint8_t>(body.begin(), body.end()));
+          }
+          ++numResults;
+          auto end = delimiter.empty() ? std::string::npos
+                                       : name->find(delimiter, prefix.size());
+          if (end == std::string::npos)
+          {
+            body += "<Blob><Name>" + *name
+                + "</Name><Properties><BlobType>BlockBlob</BlobType></Properties></Blob>";
+            ++name;
+            continue;
+          }
+          std::string blobPrefix = name->substr(0, end + delimiter.size());
+          body += "<BlobPrefix><Name>" + blobPrefix + "</Name></BlobPrefix>";
+          while (name != m_names.end() && name->compare(0, blobPrefix.size(), blobPrefix) == 0)
+          {
+            ++name;
+          }
+        }
+        body += "</Blobs><NextMarker /></EnumerationResults>";
+        return MakeResponse(
+            Azure::Core::Http::HttpStatusCode::Ok, std::vector<uint8_t>(body.begin(), body.end()));
+      }
+
+    private:
+      const std::set<std::string> m_names;
+    };
+  } // namespace
+
+  TEST(ListBlobsParallelTest, AllBlobs)
+  {
+    std::set<std::string> names;
+    for (int i = 0; i < 20; ++i)
+    {
+      names.insert("top" + std::to_string(i));
+      for (int j = 0; j < 15; ++j)
+      {
+        names.insert("dir" + std::to_string(i) + "/blob" + std::to_string(j));
+        names.insert("dir" + std::to_string(i) + "/sub/blob" + std::to_string(j));
+      }
+    }
+    auto transport = std::make_shared<FakeListingTransport>(names);
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.TransportPolicyOptions.Transport = transport;
+    Blobs::BlobContainerClient containerClient("https://a.blob.core.windows.net/c", clientOptions);
+
+    for (bool ordered : {false, true})
+    {
+      for (int splitDepth : {0, 1, 2})
+      {
+        for (int concurrency : {1, 4})
+        {
+          Blobs::ListBlobsParallelOptions options;
+          options.Ordered = ordered;
+          options.SplitDepth = splitDepth;
+          options.Concurrency = concurrency;
+          options.PageSizeHint = 7;
+          std::vector<std::string> listed;
+          containerClient.ListBlobsParallel(
+              [&listed](Blobs::Models::BlobItem blob) { listed.push_back(std::move(blob.Name)); },
+              options);
+          if (ordered)
+          {
+            EXPECT_EQ(listed, std::vector<std::string>(names.begin(), names.end()));
+          }
+          else
+          {
+            EXPECT_EQ(std::set<std::string>(listed.begin(), listed.end()), names);
+            EXPECT_EQ(listed.size(), names.size());
+          }
+        }
+      }
+    }
+
+    // only the blobs under the given prefixes
+    Blobs::ListBlobsParallelOptions options;
+    options.Ordered = true;
+    options.Prefixes = {"dir3/", "dir1", "top1"};
+    std::vector<std::string> listed;
+    containerClient.ListBlobsParallel(
+        [&listed](Blobs::Models::BlobItem blob) { listed.push_back(std::move(blob.Name)); },
+        options);
+    std::vector<std::string> expected;
+    for (const auto& name : names)
+    {
+      if (name.compare(0, 4, "dir1") == 0 || name.compare(0, 5, "dir3/") == 0
+          || name.compare(0, 4, "top1") == 0)
+      {
+        expected.push_back(name);
+      }
+    }
+    EXPECT_EQ(listed, expected);
+
+    options.Prefixes = {"dir1", "dir1/"};
+    EXPECT_THROW(
+        containerClient.ListBlobsParallel([](Blobs::Models::BlobItem) {}, options),
+        std::invalid_argument);
+  }
+
+  TEST(ListBlobsParallelTest, CallbackThrows)
+  {
+    std::set<std::string> names;
+    for (int i = 0; i < 100; ++i)
+    {
+      names.insert("dir" + std::to_string(i % 10) + "/blob" + std::to_string(i));
+    }
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.TransportPolicyOptions.Transport = std::make_shared<FakeListingTransport>(names);
+    Blobs::BlobContainerClient containerClient("https://a.blob.core.windows.net/c", clientOptions);
+
+    Blobs::ListBlobsParallelOptions options;
+    options.PageSizeHint = 2;
+    int numBlobs = 0;
+    EXPECT_THROW(
+        containerClient.ListBlobsParallel(
+            [&numBlobs](Blobs::Models::BlobItem) {
+              if (++numBlobs == 10)
+              {
+                throw std::runtime_error("stop");
+              }
+            },
+            options),
+        std::runtime_error);
+    EXPECT_EQ(numBlobs, 10);
+  }
+
+  namespace {
+    Blobs::BlobClientOptions ErrorClientOptions(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        std::string errorCode)
+    {
+      Blobs::BlobClientOptions clientOptions;
+      clientOptions.TransportPolicyOptions.Transport
+          = CannedResponseTransport::CreateError(statusCode, std::move(errorCode));
+      return clientOptions;
+    }
+  } // namespace
+
+  TEST(TryOperationsTest, NotFound)
+  {
+    auto clientOptions
+        = ErrorClientOptions(Azure::Core::Http::HttpStatusCode::NotFound, "BlobNotFound");
+    Blobs::BlobClient blobClient("https://a.blob.core.windows.net/c/b", clientOptions);
+
+    auto properties = blobClient.TryGetProperties();
+    ASSERT_FALSE(properties);
+    EXPECT_EQ(properties.GetStatusCode(), Azure::Core::Http::HttpStatusCode::NotFound);
+    EXPECT_EQ(properties.GetErrorCode(), "BlobNotFound");
+    EXPECT_EQ(properties.GetRequestId(), "request-id");
+    EXPECT_THROW(properties.ExtractResponse(), StorageException);
+
+    EXPECT_FALSE(blobClient.TryDelete());
+    auto deleteResult = blobClient.DeleteIfExists();
+    EXPECT_FALSE(deleteResult->Deleted);
+    EXPECT_EQ(deleteResult->RequestId, "request-id");
+    EXPECT_THROW(blobClient.GetProperties(), StorageException);
+    EXPECT_THROW(blobClient.Delete(), StorageException);
+
+    Blobs::BlobContainerClient containerClient(
+        "https://a.blob.core.windows.net/c",
+        ErrorClientOptions(Azure::Core::Http::HttpStatusCode::NotFound, "ContainerNotFound"));
+    EXPECT_FALSE(containerClient.TryGetProperties());
+    EXPECT_FALSE(containerClient.DeleteIfExists()->Deleted);
+    // a blob that's missing because of its container is gone too
+    Blobs::BlobClient orphanClient(
+        "https://a.blob.core.windows.net/c/b",
+        ErrorClientOptions(Azure::Core::Http::HttpStatusCode::NotFound, "ContainerNotFound"));
+    EXPECT_FALSE(orphanClient.DeleteIfExists()->Deleted);
+  }
+
+  TEST(TryOperationsTest, OtherErrorsStillThrow)
+  {
+    Blobs::BlobContainerClient existingClient(
+        "https://a.blob.core.windows.net/c",
+        ErrorClientOptions(Azure::Core::Http::HttpStatusCode::Conflict, "ContainerAlreadyExists"));
+    auto createResult = existingClient.TryCreate();
+    ASSERT_FALSE(createResult);
+    EXPECT_EQ(createResult.GetErrorCode(), "ContainerAlreadyExists");
+    EXPECT_FALSE(existingClient.CreateIfNotExists()->Created);
+
+    Blobs::BlobContainerClient forbiddenClient(
+        "https://a.blob.core.windows.net/c",
+        ErrorClientOptions(
+            Azure::Core::Http::HttpStatusCode::Forbidden, "AuthorizationPermissionMismatch"));
+    EXPECT_THROW(forbiddenClient.CreateIfNotExists(), StorageException);
+    EXPECT_THROW(forbiddenClient.DeleteIfExists(), StorageException);
+    auto deleteResult = forbiddenClient.TryDelete();
+    ASSERT_FALSE(deleteResult);
+    EXPECT_EQ(deleteResult.GetErrorCode(), "AuthorizationPermissionMismatch");
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -3,6 +3,7 @@
 
 #include "block_blob_client_test.hpp"
 
+#include <algorithm>
 #include <future>
 #include <random>
 #include <vector>
@@ -674,6 +675,308 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, ConcurrentDownloadTransactionalHash)
+  {
+    std::vector<uint8_t> blobContent = RandomBuffer(static_cast<std::size_t>(9_MB + 1234));
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    blockBlobClient.UploadFrom(blobContent.data(), blobContent.size());
+    std::string tempFilename = RandomString();
+
+    for (auto algorithm : {HashAlgorithm::Md5, HashAlgorithm::Crc64})
+    {
+      Blobs::DownloadBlobToOptions options;
+      options.TransactionalHashAlgorithm = algorithm;
+      // larger than the service returns hashes for
+      options.TransferOptions.InitialChunkSize = 8_MB;
+      options.TransferOptions.ChunkSize = 8_MB;
+      options.TransferOptions.Concurrency = 3;
+      for (int mode = 0; mode < 3; ++mode)
+      {
+        options.BlobSizeHint.Reset();
+        options.TransferOptions.SpeculativeRequestCount = 0;
+        if (mode == 1)
+        {
+          options.BlobSizeHint = static_cast<int64_t>(blobContent.size());
+        }
+        else if (mode == 2)
+        {
+          options.TransferOptions.SpeculativeRequestCount = 2;
+        }
+        std::vector<uint8_t> downloadBuffer(blobContent.size());
+        auto res
+            = blockBlobClient.DownloadTo(downloadBuffer.data(), downloadBuffer.size(), options);
+        EXPECT_EQ(res->BlobSize, static_cast<int64_t>(blobContent.size()));
+        EXPECT_EQ(downloadBuffer, blobContent);
+
+        blockBlobClient.DownloadTo(tempFilename, options);
+        EXPECT_EQ(ReadFile(tempFilename), blobContent);
+      }
+    }
+
+    auto emptyBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    std::vector<uint8_t> emptyContent;
+    emptyBlobClient.UploadFrom(emptyContent.data(), emptyContent.size());
+    Blobs::DownloadBlobToOptions options;
+    options.TransactionalHashAlgorithm = HashAlgorithm::Crc64;
+    auto res = emptyBlobClient.DownloadTo(tempFilename, options);
+    EXPECT_EQ(res->BlobSize, 0);
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(BlockBlobClientTest, SpeculativeDownload)
+  {
+    const int64_t blobSize = m_blobContent.size();
+    std::vector<uint8_t> downloadBuffer(m_blobContent.size());
+    std::string tempFilename = RandomString();
+
+    auto testDownload = [&](const Blobs::DownloadBlobToOptions& options) {
+      std::fill(downloadBuffer.begin(), downloadBuffer.end(), static_cast<uint8_t>('\x00'));
+      auto res
+          = m_blockBlobClient->DownloadTo(downloadBuffer.data(), downloadBuffer.size(), options);
+      EXPECT_EQ(res->BlobSize, blobSize);
+      EXPECT_EQ(res->ContentRange.Offset, 0);
+      EXPECT_EQ(res->ContentRange.Length.GetValue(), blobSize);
+      EXPECT_EQ(downloadBuffer, m_blobContent);
+
+      res = m_blockBlobClient->DownloadTo(tempFilename, options);
+      EXPECT_EQ(res->BlobSize, blobSize);
+      EXPECT_EQ(ReadFile(tempFilename), m_blobContent);
+    };
+
+    Blobs::DownloadBlobToOptions options;
+    options.TransferOptions.ChunkSize = 1_MB;
+    options.TransferOptions.Concurrency = 4;
+    // right size, wrong sizes fall back to the regular download
+    for (int64_t sizeHint : {blobSize, int64_t(1), blobSize - 1, blobSize + 1, blobSize * 2})
+    {
+      options.BlobSizeHint = sizeHint;
+      testDownload(options);
+    }
+    options.BlobSizeHint.Reset();
+
+    // fewer, as many and more requests than chunks
+    const int numChunks = static_cast<int>(blobSize / static_cast<int64_t>(1_MB));
+    for (int requestCount : {2, numChunks, numChunks + 3})
+    {
+      options.TransferOptions.SpeculativeRequestCount = requestCount;
+      testDownload(options);
+    }
+
+    // range
+    options.Range = Core::Http::Range();
+    options.Range.GetValue().Offset = 100;
+    const int64_t rangeLength = 3_MB;
+    options.Range.GetValue().Length = rangeLength;
+    options.TransferOptions.SpeculativeRequestCount = 2;
+    auto res = m_blockBlobClient->DownloadTo(downloadBuffer.data(), downloadBuffer.size(), options);
+    EXPECT_EQ(res->ContentRange.Length.GetValue(), rangeLength);
+    EXPECT_TRUE(std::equal(
+        downloadBuffer.begin(), downloadBuffer.begin() + rangeLength, m_blobContent.begin() + 100));
+    options.BlobSizeHint = blobSize;
+    res = m_blockBlobClient->DownloadTo(downloadBuffer.data(), downloadBuffer.size(), options);
+    EXPECT_EQ(res->ContentRange.Length.GetValue(), rangeLength);
+    EXPECT_TRUE(std::equal(
+        downloadBuffer.begin(), downloadBuffer.begin() + rangeLength, m_blobContent.begin() + 100));
+
+    DeleteFile(tempFilename);
+  }
+
+  namespace {
+    // serves ranged downloads of a single blob
+    class FakeBlobTransport : public CannedResponseTransport {
+    public:
+      explicit FakeBlobTransport(std::vector<uint8_t> content) : m_content(std::move(content))
+      {
+        Headers.emplace("x-ms-blob-type", "BlockBlob");
+        Headers.emplace("etag", "\"0x1\"");
+        Headers.emplace("last-modified", "Wed, 01 Jan 2020 00:00:00 GMT");
+        Headers.emplace("x-ms-creation-time", "Wed, 01 Jan 2020 00:00:00 GMT");
+        Headers.emplace("x-ms-server-encrypted", "true");
+      }
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Context const&,
+          Azure::Core::Http::Request& request) override
+      {
+        ++NumRequests;
+        const int64_t size = static_cast<int64_t>(m_content.size());
+        int64_t begin = 0;
+        int64_t end = size - 1;
+        const auto& headers = request.GetHeaders();
+        auto range = headers.find("x-ms-range");
+        if (range != headers.end())
+        {
+          // bytes=<begin>-<end>
+          const std::string& value = range->second;
+          auto dashPos = value.find('-');
+          begin = std::stoll(value.substr(6, dashPos - 6));
+          if (dashPos + 1 < value.size())
+          {
+            end = std::min<int64_t>(end, std::stoll(value.substr(dashPos + 1)));
+          }
+        }
+
+        if (begin >= size)
+        {
+          auto response = MakeResponse(
+              Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable, std::vector<uint8_t>());
+          response->AddHeader("x-ms-error-code", "InvalidRange");
+          return response;
+        }
+        auto response = MakeResponse(
+            Azure::Core::Http::HttpStatusCode::PartialContent,
+            std::vector<uint8_t>(m_content.begin() + begin, m_content.begin() + end + 1));
+        response->AddHeader(
+            "content-range",
+            "bytes " + std::to_string(begin) + "-" + std::to_string(end) + "/"
+                + std::to_string(size));
+        response->AddHeader("content-length", std::to_string(end - begin + 1));
+        return response;
+      }
+
+    private:
+      const std::vector<uint8_t> m_content;
+    };
+  } // namespace
+
+  TEST(SpeculativeDownloadTest, OversizedHintOnBuffer)
+  {
+    std::vector<uint8_t> content(1000);
+    for (std::size_t i = 0; i < content.size(); ++i)
+    {
+      content[i] = static_cast<uint8_t>(i);
+    }
+    auto transport = std::make_shared<FakeBlobTransport>(content);
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.TransportPolicyOptions.Transport = transport;
+    Blobs::BlobClient blobClient("https://a.blob.core.windows.net/c/b", clientOptions);
+
+    Blobs::DownloadBlobToOptions options;
+    options.TransferOptions.InitialChunkSize = 256;
+    options.TransferOptions.ChunkSize = 256;
+    // the buffer fits the blob, but not the size it's said to have
+    for (int64_t sizeHint : {int64_t(1000), int64_t(1001), int64_t(4000)})
+    {
+      options.BlobSizeHint = sizeHint;
+      std::vector<uint8_t> buffer(content.size() + 1);
+      auto result = blobClient.DownloadTo(buffer.data(), buffer.size(), options);
+      EXPECT_EQ(result->BlobSize, 1000);
+      EXPECT_TRUE(std::equal(content.begin(), content.end(), buffer.begin())) << sizeHint;
+    }
+
+    // a blob that really doesn't fit still fails
+    options.BlobSizeHint = 4000;
+    std::vector<uint8_t> smallBuffer(500);
+    EXPECT_THROW(
+        blobClient.DownloadTo(smallBuffer.data(), smallBuffer.size(), options),
+        Azure::Core::RequestFailedException);
+  }
+
+  TEST_F(BlockBlobClientTest, OpenRead)
+  {
+    Blobs::OpenReadBlobOptions options;
+    options.TransferOptions.ChunkSize = 1_MB;
+    options.TransferOptions.WindowSize = 3_MB;
+    auto stream = m_blockBlobClient->OpenRead(options);
+    EXPECT_EQ(stream->Length(), static_cast<int64_t>(m_blobContent.size()));
+    EXPECT_EQ(ReadBodyStream(stream), m_blobContent);
+
+    options.Range = Core::Http::Range();
+    options.Range.GetValue().Offset = 100;
+    options.Range.GetValue().Length = 2_MB + 1;
+    stream = m_blockBlobClient->OpenRead(options);
+    EXPECT_EQ(
+        ReadBodyStream(stream),
+        std::vector<uint8_t>(
+            m_blobContent.begin() + 100, m_blobContent.begin() + 100 + 2_MB + 1));
+
+    // The stream keeps reading the version of the blob it was opened on.
+    auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    auto blobContent
+        = Azure::Core::Http::MemoryBodyStream(m_blobContent.data(), m_blobContent.size());
+    blockBlobClient.Upload(&blobContent);
+    options.Range.Reset();
+    stream = blockBlobClient.OpenRead(options);
+    std::vector<uint8_t> buffer(m_blobContent.size());
+    EXPECT_EQ(stream->Read(Azure::Core::Context(), buffer.data(), 1), 1);
+    blobContent.Rewind();
+    blockBlobClient.Upload(&blobContent);
+    EXPECT_THROW(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), *stream, buffer.data(), buffer.size()),
+        StorageException);
+  }
+
+  TEST_F(BlockBlobClientTest, RandomAccessReader)
+  {
+    Blobs::OpenBlobRandomAccessReaderOptions options;
+    options.TransferOptions.BlockSize = 64_KB;
+    options.TransferOptions.CacheSize = 1_MB;
+    auto reader = m_blockBlobClient->OpenRandomAccessReader(options);
+    EXPECT_EQ(reader.GetBlobSize(), static_cast<int64_t>(m_blobContent.size()));
+    EXPECT_TRUE(reader.GetETag().HasValue());
+
+    // footer first, then scattered chunks
+    reader.Prefetch({{1_MB, 100_KB}, {3_MB, 10}});
+    for (int64_t offset : std::vector<int64_t>{8_MB - 8, 1_MB + 10, 3_MB, 5_MB - 1, 0, 1_MB})
+    {
+      std::vector<uint8_t> buffer(static_cast<std::size_t>(100_KB));
+      int64_t bytesRead = reader.ReadAt(offset, buffer.data(), buffer.size());
+      int64_t expectedBytesRead = std::min(
+          static_cast<int64_t>(buffer.size()), static_cast<int64_t>(m_blobContent.size()) - offset);
+      ASSERT_EQ(bytesRead, expectedBytesRead);
+      EXPECT_TRUE(std::equal(
+          buffer.begin(), buffer.begin() + bytesRead, m_blobContent.begin() + offset));
+    }
+    uint8_t byte;
+    EXPECT_EQ(reader.ReadAt(8_MB, &byte, 1), 0);
+  }
+
+  TEST_F(BlockBlobClientTest, DownloadRanges)
+  {
+    // adjacent, overlapping, scattered and larger than a chunk
+    std::vector<std::pair<int64_t, int64_t>> ranges = {
+        {static_cast<int64_t>(8_MB) - 8, 8},
+        {0, 100},
+        {100, 200},
+        {150, 50},
+        {static_cast<int64_t>(1_MB), static_cast<int64_t>(2_MB) + 1},
+        {static_cast<int64_t>(5_MB), 1},
+    };
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<Blobs::BlobRangeBuffer> rangeBuffers;
+    for (const auto& range : ranges)
+    {
+      buffers.emplace_back(static_cast<std::size_t>(range.second));
+    }
+    for (std::size_t i = 0; i < ranges.size(); ++i)
+    {
+      Blobs::BlobRangeBuffer rangeBuffer;
+      rangeBuffer.Offset = ranges[i].first;
+      rangeBuffer.Length = ranges[i].second;
+      rangeBuffer.Buffer = buffers[i].data();
+      rangeBuffers.push_back(rangeBuffer);
+    }
+
+    Blobs::DownloadBlobRangesOptions options;
+    options.TransferOptions.ChunkSize = 1_MB;
+    auto res = m_blockBlobClient->DownloadRanges(rangeBuffers, options);
+    EXPECT_EQ(res->BlobSize, static_cast<int64_t>(m_blobContent.size()));
+    EXPECT_TRUE(res->Details.ETag.HasValue());
+    for (std::size_t i = 0; i < ranges.size(); ++i)
+    {
+      EXPECT_TRUE(std::equal(
+          buffers[i].begin(), buffers[i].end(), m_blobContent.begin() + ranges[i].first));
+    }
+
+    options.TransferOptions.MergeGapSize = 1_MB;
+    EXPECT_NO_THROW(m_blockBlobClient->DownloadRanges(rangeBuffers, options));
+
+    rangeBuffers.back().Offset = static_cast<int64_t>(8_MB);
+    EXPECT_THROW(m_blockBlobClient->DownloadRanges(rangeBuffers), std::runtime_error);
+  }
+
   TEST_F(BlockBlobClientTest, ConcurrentUploadFromNonExistingFile)
   {
     auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
@@ -910,6 +1213,48 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, ConcurrentUploadTransactionalHash)
+  {
+    std::vector<uint8_t> blobContent = RandomBuffer(static_cast<std::size_t>(3_MB + 1234));
+    std::string tempFilename = RandomString();
+    {
+      Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(blobContent.data(), static_cast<int64_t>(blobContent.size()), 0);
+    }
+    Crc64Hash crc64;
+    const auto blobCrc64 = crc64.Final(blobContent.data(), blobContent.size());
+
+    for (auto algorithm : {HashAlgorithm::Md5, HashAlgorithm::Crc64})
+    {
+      for (int64_t singleUploadThreshold : {0ULL, 4_MB})
+      {
+        Azure::Storage::Blobs::UploadBlockBlobFromOptions options;
+        options.TransactionalHashAlgorithm = algorithm;
+        options.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+        options.TransferOptions.ChunkSize = 1_MB;
+        options.TransferOptions.Concurrency = 2;
+
+        for (bool fromFile : {false, true})
+        {
+          auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+          auto res = fromFile
+              ? blockBlobClient.UploadFrom(tempFilename, options)
+              : blockBlobClient.UploadFrom(blobContent.data(), blobContent.size(), options);
+          if (algorithm == HashAlgorithm::Crc64)
+          {
+            ASSERT_TRUE(res->TransactionalContentHash.HasValue());
+            EXPECT_EQ(res->TransactionalContentHash.GetValue().Algorithm, HashAlgorithm::Crc64);
+            EXPECT_EQ(res->TransactionalContentHash.GetValue().Value, blobCrc64);
+          }
+          std::vector<uint8_t> downloadContent(blobContent.size());
+          blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size());
+          EXPECT_EQ(downloadContent, blobContent);
+        }
+      }
+    }
+    DeleteFile(tempFilename);
+  }
+
   TEST_F(BlockBlobClientTest, DownloadError)
   {
     auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of computing the CRC64 of a block.
+ *
+ */
+
+#pragma once
+
+#include <azure/performance_framework.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test { namespace Performance {
+
+  /**
+   * @brief A test to measure the transactional CRC64 of an upload or download block.
+   *
+   */
+  class Crc64HashTest : public Azure::PerformanceStress::PerformanceTest {
+  private:
+    std::vector<uint8_t> m_data;
+    int m_concurrency = 1;
+
+  public:
+    /**
+     * @brief Construct a new Crc64HashTest test.
+     *
+     * @param options The test options.
+     */
+    Crc64HashTest(Azure::PerformanceStress::TestOptions options) : PerformanceTest(options) {}
+
+    /**
+     * @brief Create the data to hash.
+     *
+     */
+    void Setup() override
+    {
+      m_data.resize(m_options.GetOptionOrDefault<std::size_t>("Size", 4 * 1024 * 1024));
+      for (std::size_t i = 0; i < m_data.size(); ++i)
+      {
+        m_data[i] = static_cast<uint8_t>(i * 31 + 7);
+      }
+      m_concurrency = m_options.GetOptionOrDefault<int>("Concurrency", 1);
+    }
+
+    /**
+     * @brief Define the test
+     *
+     * @param ctx The cancellation token.
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      Azure::Storage::Crc64Hash hash;
+      hash.ParallelAppend(m_data.data(), m_data.size(), m_concurrency);
+      hash.Final();
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::PerformanceStress::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size"}, "The number of bytes to hash, 4 MiB by default.", 1, false},
+          {"Concurrency",
+           {"--concurrency"},
+           "The number of threads to hash a block with, 1 by default.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::PerformanceStress::TestMetadata describing the test.
+     */
+    static Azure::PerformanceStress::TestMetadata GetTestMetadata()
+    {
+      return {
+          "Crc64HashTest",
+          "Compute the CRC64 of a block.",
+          [](Azure::PerformanceStress::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::Performance::Crc64HashTest>(
+                options);
+          }};
+    }
+  };
+
+}}}}} // namespace Azure::Storage::Blobs::Test::Performance
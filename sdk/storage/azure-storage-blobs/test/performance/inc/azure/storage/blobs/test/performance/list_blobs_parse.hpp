@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of deserializing a page of a blob listing.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/transport.hpp>
+#include <azure/performance_framework.hpp>
+#include <azure/storage/blobs.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test { namespace Performance {
+
+  /**
+   * @brief A test to measure listing a page of blobs from a transport that returns the same
+   * response every time, so that only the client side work is measured.
+   *
+   */
+  class ListBlobsParse : public Azure::PerformanceStress::PerformanceTest {
+  private:
+    class CannedListTransport : public Azure::Core::Http::HttpTransport {
+    private:
+      std::shared_ptr<const std::vector<uint8_t>> m_body;
+
+    public:
+      explicit CannedListTransport(std::shared_ptr<const std::vector<uint8_t>> body)
+          : m_body(std::move(body))
+      {
+      }
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Context const&,
+          Azure::Core::Http::Request&) override
+      {
+        auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+        response->AddHeader("x-ms-request-id", "0f6b2a3c-1c7e-4c1e-9d6b-3b6f6a9e2b10");
+        response->AddHeader("x-ms-version", "2020-02-10");
+        response->AddHeader("content-type", "application/xml");
+        response->SetBodyStream(
+            std::make_unique<Azure::Core::Http::MemoryBodyStream>(m_body->data(), m_body->size()));
+        return response;
+      }
+    };
+
+    std::unique_ptr<Azure::Storage::Blobs::BlobContainerClient> m_containerClient;
+    Azure::Storage::Blobs::ListBlobsSinglePageOptions m_listOptions;
+    bool m_compact = false;
+
+  public:
+    /**
+     * @brief Construct a new ListBlobsParse test.
+     *
+     * @param options The test options.
+     */
+    ListBlobsParse(Azure::PerformanceStress::TestOptions options) : PerformanceTest(options) {}
+
+    /**
+     * @brief Build the listing response and a container client sending to the canned transport.
+     *
+     */
+    void Setup() override
+    {
+      const int count = m_options.GetOptionOrDefault<int>("Count", 5000);
+
+      std::string xml
+          = "<?xml version=\"1.0\" encoding=\"utf-8\"?><EnumerationResults "
+            "ServiceEndpoint=\"https://account.blob.core.windows.net/\" "
+            "ContainerName=\"container\"><MaxResults>"
+          + std::to_string(count) + "</MaxResults><Blobs>";
+      for (int i = 0; i < count; ++i)
+      {
+        xml += "<Blob><Name>logs/2021/02/18/part-" + std::to_string(100000 + i)
+            + ".json</Name><Properties>"
+              "<Creation-Time>Thu, 18 Feb 2021 08:00:00 GMT</Creation-Time>"
+              "<Last-Modified>Thu, 18 Feb 2021 08:03:09 GMT</Last-Modified>"
+              "<Etag>0x8D8D3F1E2A3B4C5</Etag>"
+              "<Content-Length>4194304</Content-Length>"
+              "<Content-Type>application/octet-stream</Content-Type>"
+              "<Content-Encoding /><Content-Language /><Content-CRC64 />"
+              "<Content-MD5>1B2M2Y8AsgTpgAmY7PhCfg==</Content-MD5>"
+              "<Cache-Control /><Content-Disposition />"
+              "<BlobType>BlockBlob</BlobType>"
+              "<AccessTier>Hot</AccessTier><AccessTierInferred>true</AccessTierInferred>"
+              "<LeaseStatus>unlocked</LeaseStatus><LeaseState>available</LeaseState>"
+              "<ServerEncrypted>true</ServerEncrypted>"
+              "</Properties><OrMetadata /></Blob>";
+      }
+      xml += "</Blobs><NextMarker>2!96!MDAwMDQ0IWxvZ3MvMjAyMS8wMi8xOC9wYXJ0LTEwNTAwMC5qc29uITAw"
+             "MDAyOCE5OTk5LTEyLTMxVDIzOjU5OjU5Ljk5OTk5OTlaIQ--</NextMarker></EnumerationResults>";
+      auto body = std::make_shared<const std::vector<uint8_t>>(xml.begin(), xml.end());
+
+      Azure::Storage::Blobs::BlobClientOptions clientOptions;
+      clientOptions.TransportPolicyOptions.Transport = std::make_shared<CannedListTransport>(body);
+      m_containerClient = std::make_unique<Azure::Storage::Blobs::BlobContainerClient>(
+          "https://account.blob.core.windows.net/container", clientOptions);
+
+      if (m_options.GetOptionOrDefault<bool>("Stream", false))
+      {
+        m_listOptions.OnBlobItem = [](Azure::Storage::Blobs::Models::BlobItem) {};
+      }
+      m_compact = m_options.GetOptionOrDefault<bool>("Compact", false);
+    }
+
+    /**
+     * @brief Define the test
+     *
+     * @param ctx The cancellation token.
+     */
+    void Run(Azure::Core::Context const& ctx) override
+    {
+      if (m_compact)
+      {
+        auto page = m_containerClient->ListBlobsCompactSinglePage(m_listOptions, ctx);
+        (void)page;
+      }
+      else
+      {
+        auto page = m_containerClient->ListBlobsSinglePage(m_listOptions, ctx);
+        (void)page;
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::PerformanceStress::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Count", {"--count"}, "The number of blobs in the page, 5000 by default.", 1, false},
+          {"Stream",
+           {"--stream"},
+           "Hand blobs to a callback while the response is parsed from the stream.",
+           1,
+           false},
+          {"Compact", {"--compact"}, "List into a ListBlobsCompactSinglePageResult.", 1, false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::PerformanceStress::TestMetadata describing the test.
+     */
+    static Azure::PerformanceStress::TestMetadata GetTestMetadata()
+    {
+      return {
+          "ListBlobsParse",
+          "List a page of blobs from a canned response.",
+          [](Azure::PerformanceStress::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::Performance::ListBlobsParse>(
+                options);
+          }};
+    }
+  };
+
+}}}}} // namespace Azure::Storage::Blobs::Test::Performance
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of signing a request with a shared key.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/policy.hpp>
+#include <azure/performance_framework.hpp>
+#include <azure/storage/common/shared_key_policy.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test { namespace Performance {
+
+  /**
+   * @brief A test to measure the shared key policy on a typical blob request, without sending it.
+   *
+   */
+  class SharedKeySigning : public Azure::PerformanceStress::PerformanceTest {
+  private:
+    class NoOpTransportPolicy : public Azure::Core::Http::HttpPolicy {
+    public:
+      std::unique_ptr<Azure::Core::Http::HttpPolicy> Clone() const override
+      {
+        return std::make_unique<NoOpTransportPolicy>(*this);
+      }
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Context const&,
+          Azure::Core::Http::Request&,
+          Azure::Core::Http::NextHttpPolicy) const override
+      {
+        return nullptr;
+      }
+    };
+
+    std::vector<std::unique_ptr<Azure::Core::Http::HttpPolicy>> m_policies;
+    std::unique_ptr<Azure::Core::Http::Request> m_request;
+
+  public:
+    /**
+     * @brief Construct a new SharedKeySigning test.
+     *
+     * @param options The test options.
+     */
+    SharedKeySigning(Azure::PerformanceStress::TestOptions options) : PerformanceTest(options) {}
+
+    /**
+     * @brief Create the policy and a request with the headers and query parameters of a block
+     * upload.
+     *
+     */
+    void Setup() override
+    {
+      auto credential = std::make_shared<StorageSharedKeyCredential>(
+          "account", "8CwtGFF1mGR4bPEP9eZ0x1fxKiQ3Ca5NbPEP9eZ0x1fxKiQ3Ca5N8CwtGFF1mGR4bA==");
+      m_policies.push_back(std::make_unique<Azure::Storage::Details::SharedKeyPolicy>(credential));
+      m_policies.push_back(std::make_unique<NoOpTransportPolicy>());
+
+      m_request = std::make_unique<Azure::Core::Http::Request>(
+          Azure::Core::Http::HttpMethod::Put,
+          Azure::Core::Http::Url("https://account.blob.core.windows.net/container/"
+                                 "blob?comp=block&blockid=MDAwMDAwMDAwMDAwMDAwMDAwMDAwMDAx"));
+      m_request->AddHeader("Content-Length", "4194304");
+      m_request->AddHeader("Content-Type", "application/octet-stream");
+      m_request->AddHeader("User-Agent", "azsdk-cpp-storage-blobs/12.0.0-beta.9");
+      m_request->AddHeader("x-ms-client-request-id", "0f6b2a3c-1c7e-4c1e-9d6b-3b6f6a9e2b10");
+      m_request->AddHeader("x-ms-date", "Thu, 18 Feb 2021 08:00:00 GMT");
+      m_request->AddHeader("x-ms-version", "2020-02-10");
+    }
+
+    /**
+     * @brief Define the test
+     *
+     * @param ctx The cancellation token.
+     */
+    void Run(Azure::Core::Context const& ctx) override
+    {
+      m_policies[0]->Send(ctx, *m_request, Azure::Core::Http::NextHttpPolicy(0, m_policies));
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::PerformanceStress::TestMetadata describing the test.
+     */
+    static Azure::PerformanceStress::TestMetadata GetTestMetadata()
+    {
+      return {
+          "SharedKeySigning",
+          "Sign a block upload request with a shared key.",
+          [](Azure::PerformanceStress::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::Performance::SharedKeySigning>(
+                options);
+          }};
+    }
+  };
+
+}}}}} // namespace Azure::Storage::Blobs::Test::Performance
@@ -3,14 +3,20 @@
 
 #include <azure/performance_framework.hpp>
 
+#include "azure/storage/blobs/test/performance/crc64_hash.hpp"
 #include "azure/storage/blobs/test/performance/download_blob.hpp"
+#include "azure/storage/blobs/test/performance/list_blobs_parse.hpp"
+#include "azure/storage/blobs/test/performance/shared_key_signing.hpp"
 
 int main(int argc, char** argv)
 {
 
   // Create the test list
   std::vector<Azure::PerformanceStress::TestMetadata> tests{
-      Azure::Storage::Blobs::Test::Performance::DownloadBlob::GetTestMetadata()};
+      Azure::Storage::Blobs::Test::Performance::Crc64HashTest::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::Performance::DownloadBlob::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::Performance::ListBlobsParse::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::Performance::SharedKeySigning::GetTestMetadata()};
 
   Azure::PerformanceStress::Program::Run(Azure::Core::GetApplicationContext(), tests, argc, argv);
 
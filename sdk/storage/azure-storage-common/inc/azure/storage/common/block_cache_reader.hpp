@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <azure/core/context.hpp>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  /**
+   * @brief Serves reads at arbitrary offsets of a remote resource from an LRU cache of
+   * fixed-size blocks. Adjacent missing blocks are coalesced into a single request of up to
+   * maxRequestSize bytes, the requests of one read run in parallel, and concurrent reads of the
+   * same block share a single fetch. Must be created with std::make_shared, prefetches keep it
+   * alive until they finish.
+   */
+  class BlockCacheReader : public std::enable_shared_from_this<BlockCacheReader> {
+  public:
+    /**
+     * @brief Reads exactly length bytes of the resource starting at offset into buffer, or
+     * throws.
+     */
+    using RangeFetcher = std::function<
+        void(int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context& context)>;
+
+    /**
+     * @brief Initializes a new instance of BlockCacheReader.
+     *
+     * @param size Size of the resource.
+     * @param blockSize Size of a cached block.
+     * @param cacheSize The maximum number of bytes kept in the cache.
+     * @param maxRequestSize The maximum number of bytes fetched by a single request.
+     * @param concurrency The maximum number of parallel requests of a single read or prefetch.
+     * @param fetcher Fetches a range, may be called on executor threads.
+     */
+    explicit BlockCacheReader(
+        int64_t size,
+        int64_t blockSize,
+        int64_t cacheSize,
+        int64_t maxRequestSize,
+        int concurrency,
+        RangeFetcher fetcher);
+
+    BlockCacheReader(const BlockCacheReader&) = delete;
+    BlockCacheReader& operator=(const BlockCacheReader&) = delete;
+
+    /**
+     * @brief Gets the size of the resource.
+     */
+    int64_t GetSize() const { return m_size; }
+
+    /**
+     * @brief Reads up to count bytes starting at offset. Blocks that failed to be fetched by a
+     * prefetch or another read are fetched again with this read's context.
+     *
+     * @return The number of bytes read, less than count only at the end of the resource.
+     */
+    int64_t ReadAt(
+        int64_t offset,
+        uint8_t* buffer,
+        int64_t count,
+        const Azure::Core::Context& context);
+
+    /**
+     * @brief Starts fetching the blocks covering the given (offset, length) ranges in the
+     * background. Ranges that fall into the same or adjacent blocks are fetched together.
+     */
+    void Prefetch(const std::vector<std::pair<int64_t, int64_t>>& ranges);
+
+  private:
+    struct Block
+    {
+      std::vector<uint8_t> Data;
+      bool Ready = false;
+      std::exception_ptr Error;
+      // position in m_lru, only valid while Ready and cached
+      std::list<int64_t>::iterator LruPosition;
+    };
+
+    // Blocks fetched with a single request.
+    struct Run
+    {
+      int64_t FirstBlockId = 0;
+      std::vector<std::shared_ptr<Block>> Blocks;
+      bool Done = false;
+    };
+
+    // Expects m_mutex to be held.
+    std::shared_ptr<Block> AcquireBlock(int64_t blockId, std::vector<Run>& missingRuns);
+    void FetchRuns(std::vector<Run>& runs, const Azure::Core::Context& context);
+    void FetchRun(Run& run, const Azure::Core::Context& context);
+    void FailRun(Run& run, std::exception_ptr error);
+    // Expects m_mutex to be held.
+    void Evict();
+
+    const int64_t m_size;
+    const int64_t m_blockSize;
+    const int64_t m_cacheSize;
+    const int64_t m_blocksPerRequest;
+    const int m_concurrency;
+    RangeFetcher m_fetcher;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // protected by m_mutex
+    std::map<int64_t, std::shared_ptr<Block>> m_blocks;
+    // ids of the blocks that are ready, most recently used first
+    std::list<int64_t> m_lru;
+    int64_t m_cachedBytes = 0;
+  };
+
+}}} // namespace Azure::Storage::Details
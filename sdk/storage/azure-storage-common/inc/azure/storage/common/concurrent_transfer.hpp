@@ -3,71 +3,166 @@
 
 #pragma once
 
-#include <algorithm>
 #include <atomic>
-#include <cstdlib>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
-#include <future>
-#include <stdexcept>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
+#include <azure/core/context.hpp>
+
 namespace Azure { namespace Storage { namespace Details {
 
-  inline void ConcurrentTransfer(
-      int64_t offset,
-      int64_t length,
-      int64_t chunkSize,
-      int concurrency,
-      // offset, length, chunk id, number of chunks
-      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc)
-  {
-    std::atomic<int> numWorkingThreads{concurrency};
-    std::atomic<int> nextChunkId{0};
-    std::atomic<bool> failed{false};
+  /**
+   * @brief A bounded pool of worker threads that parallel transfers schedule their work onto.
+   * Each worker owns a task queue, idle workers steal tasks queued on busy ones. Threads are
+   * created on demand, up to the maximum, and are reused afterwards.
+   */
+  class TransferExecutor {
+  public:
+    /**
+     * @brief Gets the process-wide executor shared by all blob, share and datalake transfers.
+     */
+    static TransferExecutor& GetDefault();
 
-    const auto numChunks = (length + chunkSize - 1) / chunkSize;
+    /**
+     * @brief Initializes a new instance of TransferExecutor.
+     *
+     * @param maxThreads The maximum number of worker threads.
+     */
+    explicit TransferExecutor(std::size_t maxThreads);
 
-    auto threadFunc = [&]() {
-      while (true)
-      {
-        int chunkId = nextChunkId.fetch_add(1);
-        if (chunkId >= numChunks || failed)
-        {
-          break;
-        }
-        int64_t chunkOffset = offset + chunkSize * chunkId;
-        int64_t chunkLength = std::min(length - chunkSize * chunkId, chunkSize);
-        try
-        {
-          transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
-        }
-        catch (std::exception&)
-        {
-          if (failed.exchange(true) == false)
-          {
-            numWorkingThreads.fetch_sub(1);
-            throw;
-          }
-        }
-      }
-      numWorkingThreads.fetch_sub(1);
-    };
+    TransferExecutor(const TransferExecutor&) = delete;
+    TransferExecutor& operator=(const TransferExecutor&) = delete;
 
-    std::vector<std::future<void>> threadHandles;
-    for (int i = 0; i < concurrency - 1; ++i)
-    {
-      threadHandles.emplace_back(std::async(std::launch::async, threadFunc));
-    }
-    threadFunc();
-    for (auto& handle : threadHandles)
+    /**
+     * @brief Waits for the queued tasks to finish and stops all worker threads.
+     */
+    ~TransferExecutor();
+
+    /**
+     * @brief Queues a task. Tasks must not throw.
+     *
+     * @param task The task to run on a worker thread.
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * @brief Gets the maximum number of worker threads.
+     */
+    std::size_t GetMaxThreads() const { return m_workers.size(); }
+
+  private:
+    struct Worker
     {
-      handle.get();
-    }
+      std::mutex Mutex;
+      std::deque<std::function<void()>> Tasks;
+      std::thread Thread;
+    };
+
+    void WorkerFunc(std::size_t workerId);
+    std::function<void()> TakeTask(std::size_t workerId);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // protected by m_mutex
+    std::size_t m_numThreads = 0;
+    std::size_t m_numIdleThreads = 0;
+    std::size_t m_numPendingTasks = 0;
+    std::size_t m_nextWorker = 0;
+    bool m_stopped = false;
+  };
+
+  /**
+   * @brief A piece of work queued on TransferExecutor::GetDefault(). If no worker has started it
+   * by the time someone waits for it, the waiting thread runs it inline, so waiting can't
+   * deadlock on a busy executor.
+   */
+  class TransferTask {
+  public:
+    /**
+     * @brief Queues func on the default executor.
+     *
+     * @param func The work to run.
+     */
+    explicit TransferTask(std::function<void()> func);
 
-    if (numWorkingThreads != 0)
+    TransferTask(const TransferTask&) = delete;
+    TransferTask& operator=(const TransferTask&) = delete;
+
+    /**
+     * @brief Waits for the task, exceptions thrown by it are discarded.
+     */
+    ~TransferTask();
+
+    /**
+     * @brief Waits for the task to finish and rethrows the exception it threw, if any.
+     */
+    void Wait();
+
+  private:
+    struct State
     {
-      std::abort();
-    }
-  }
+      enum class Status
+      {
+        Queued,
+        Running,
+        Finished,
+      };
+
+      std::function<void()> Func;
+      std::exception_ptr Error;
+      std::atomic<Status> TaskStatus{Status::Queued};
+      std::mutex Mutex;
+      std::condition_variable Cv;
+
+      void TryRun();
+    };
+
+    void WaitFinished();
+
+    std::shared_ptr<State> m_state;
+  };
+
+  /**
+   * @brief Splits a range into chunks and calls transferFunc on each of them with up to
+   * concurrency workers. The calling thread is always one of the workers, the others are
+   * scheduled on TransferExecutor::GetDefault(). Once a chunk fails or the context is cancelled,
+   * no more chunks are started and the first exception is rethrown after all workers return.
+   */
+  void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      // offset, length, chunk id, number of chunks
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      const Azure::Core::Context& context);
+
+  /**
+   * @brief Walks a tree of directories with up to concurrency workers. walkFunc lists the
+   * directory at a path, relative to the root, and appends the paths of the subdirectories to
+   * walk into. The directories are taken from a shared stack, so the tree is walked roughly depth
+   * first and the pending directories stay few. The calling thread is always one of the workers,
+   * the others are scheduled on TransferExecutor::GetDefault(). Once a directory fails or the
+   * context is cancelled, the context passed to walkFunc is cancelled, no more directories are
+   * started and the first exception is rethrown after all workers return.
+   */
+  void ConcurrentTreeWalk(
+      std::string root,
+      int concurrency,
+      // path, depth of the directory under the root, subdirectories to walk, context
+      std::function<
+          void(const std::string&, int, std::vector<std::string>&, const Azure::Core::Context&)>
+          walkFunc,
+      const Azure::Core::Context& context);
 
 }}} // namespace Azure::Storage::Details
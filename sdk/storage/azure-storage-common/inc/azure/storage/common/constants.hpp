@@ -20,6 +20,7 @@ namespace Azure { namespace Storage {
     constexpr static const char* HttpHeaderRequestId = "x-ms-request-id";
     constexpr static const char* HttpHeaderClientRequestId = "x-ms-client-request-id";
     constexpr static const char* HttpHeaderContentType = "content-type";
+    constexpr static const char* HttpHeaderErrorCode = "x-ms-error-code";
     constexpr static const char* DefaultSasVersion = "2020-02-10";
 
     constexpr int ReliableStreamRetryCount = 3;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -16,6 +17,16 @@ namespace Azure { namespace Storage {
   public:
     void Concatenate(const Crc64Hash& other);
 
+    /**
+     * @brief Appends a large buffer by hashing slices of it on up to concurrency threads and
+     * concatenating the partial results. Small buffers are appended on the calling thread.
+     *
+     * @param data The data to append.
+     * @param length The length of the data.
+     * @param concurrency The maximum number of threads to use, including the calling thread.
+     */
+    void ParallelAppend(const uint8_t* data, std::size_t length, int concurrency);
+
     ~Crc64Hash() override = default;
 
   private:
@@ -31,6 +42,28 @@ namespace Azure { namespace Storage {
     std::vector<uint8_t> HmacSha256(
         const std::vector<uint8_t>& data,
         const std::vector<uint8_t>& key);
+
+    /**
+     * @brief HMAC-SHA256 with a fixed key. The padded key is hashed into the inner and outer
+     * states once, each signature only hashes the data.
+     */
+    class HmacSha256Context {
+    public:
+      static constexpr std::size_t HashLength = 32;
+
+      explicit HmacSha256Context(const std::vector<uint8_t>& key);
+      HmacSha256Context(const HmacSha256Context&) = delete;
+      HmacSha256Context& operator=(const HmacSha256Context&) = delete;
+      ~HmacSha256Context();
+
+      // Writes HashLength bytes to hash. May be called from multiple threads.
+      void Sign(const uint8_t* data, std::size_t length, uint8_t* hash) const;
+
+    private:
+      struct State;
+      std::unique_ptr<State> m_state;
+    };
+
     std::string UrlEncodeQueryParameter(const std::string& value);
     std::string UrlEncodePath(const std::string& value);
   } // namespace Details
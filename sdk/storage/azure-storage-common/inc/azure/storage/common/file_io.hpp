@@ -18,6 +18,9 @@
 #include <cstdint>
 #include <string>
 
+#include <azure/core/context.hpp>
+#include <azure/core/http/body_stream.hpp>
+
 namespace Azure { namespace Storage { namespace Details {
 
 #if defined(AZ_PLATFORM_WINDOWS)
@@ -55,4 +58,16 @@ namespace Azure { namespace Storage { namespace Details {
     FileHandle m_handle;
   };
 
+  /**
+   * @brief Reads length bytes from stream and writes them to the file starting at offset. Reading
+   * from the stream and writing to the file overlap, the next buffer is read from the stream while
+   * the previous one is being written.
+   */
+  void BodyStreamToFile(
+      Azure::Core::Http::BodyStream& stream,
+      FileWriter& fileWriter,
+      int64_t offset,
+      int64_t length,
+      const Azure::Core::Context& context);
+
 }}} // namespace Azure::Storage::Details
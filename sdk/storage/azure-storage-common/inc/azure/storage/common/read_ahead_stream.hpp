@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/body_stream.hpp>
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+
+namespace Azure { namespace Storage { namespace Details {
+
+  /**
+   * @brief A body stream that reads a range of a remote resource sequentially while fetching the
+   * upcoming chunks in parallel. Up to a window of chunks are fetched ahead of the reader on
+   * TransferExecutor::GetDefault(), bytes are handed out in order.
+   */
+  class ReadAheadStream : public Azure::Core::Http::BodyStream {
+  public:
+    /**
+     * @brief Reads exactly length bytes of the resource starting at offset into buffer, or
+     * throws.
+     */
+    using ChunkFetcher = std::function<
+        void(int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context& context)>;
+
+    /**
+     * @brief Initializes a new instance of ReadAheadStream.
+     *
+     * @param offset Offset of the range in the resource.
+     * @param length Length of the range.
+     * @param chunkSize The size of a single fetch.
+     * @param windowSize The maximum number of bytes fetched ahead of the reader.
+     * @param fetcher Fetches a chunk, called on executor threads.
+     * @param context Context for the fetches. The stream cancels its fetches when destroyed.
+     */
+    explicit ReadAheadStream(
+        int64_t offset,
+        int64_t length,
+        int64_t chunkSize,
+        int64_t windowSize,
+        ChunkFetcher fetcher,
+        const Azure::Core::Context& context);
+
+    ReadAheadStream(const ReadAheadStream&) = delete;
+    ReadAheadStream& operator=(const ReadAheadStream&) = delete;
+
+    ~ReadAheadStream() override;
+
+    int64_t Length() const override { return m_length; }
+
+    void Rewind() override;
+
+  private:
+    struct Chunk
+    {
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      std::vector<uint8_t> Buffer;
+      std::unique_ptr<TransferTask> Task;
+    };
+
+    int64_t OnRead(const Azure::Core::Context& context, uint8_t* buffer, int64_t count) override;
+    void FillWindow();
+    void ClearWindow();
+
+    const int64_t m_offset;
+    const int64_t m_length;
+    const int64_t m_chunkSize;
+    const std::size_t m_windowChunks;
+    ChunkFetcher m_fetcher;
+    Azure::Core::Context m_context;
+
+    std::deque<Chunk> m_window;
+    std::vector<std::vector<uint8_t>> m_freeBuffers;
+    // offset from the beginning of the range of the next chunk to fetch
+    int64_t m_nextFetchOffset = 0;
+    // read position in the front chunk of the window
+    int64_t m_chunkPosition = 0;
+  };
+
+}}} // namespace Azure::Storage::Details
@@ -12,6 +12,13 @@
 
 namespace Azure { namespace Storage { namespace Details {
 
+  // Writes the string-to-sign of the Shared Key scheme for request to stringToSign, replacing its
+  // content but keeping its capacity.
+  void BuildSharedKeyStringToSign(
+      const Core::Http::Request& request,
+      const std::string& accountName,
+      std::string& stringToSign);
+
   class SharedKeyPolicy : public Core::Http::HttpPolicy {
   public:
     explicit SharedKeyPolicy(std::shared_ptr<StorageSharedKeyCredential> credential)
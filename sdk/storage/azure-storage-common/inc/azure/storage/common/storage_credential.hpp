@@ -20,7 +20,8 @@ namespace Azure { namespace Storage {
 
   namespace Details {
     class SharedKeyPolicy;
-  }
+    class HmacSha256Context;
+  } // namespace Details
 
   /**
    * @brief A StorageSharedKeyCredential is a credential backed by a storage account's name and
@@ -50,6 +51,7 @@ namespace Azure { namespace Storage {
     {
       std::lock_guard<std::mutex> guard(m_mutex);
       m_accountKey = std::move(accountKey);
+      m_signingContext.reset();
     }
 
     /**
@@ -69,8 +71,12 @@ namespace Azure { namespace Storage {
       return m_accountKey;
     }
 
+    // HMAC state of the decoded account key, created on first use and dropped on Update.
+    std::shared_ptr<const Details::HmacSha256Context> GetSigningContext() const;
+
     mutable std::mutex m_mutex;
     std::string m_accountKey;
+    mutable std::shared_ptr<const Details::HmacSha256Context> m_signingContext;
   };
 
   namespace Details {
@@ -0,0 +1,253 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <azure/core/context.hpp>
+#include <azure/core/nullable.hpp>
+#include <azure/core/response.hpp>
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief Optional parameters for iterating over the pages of a listing.
+   */
+  struct PagerOptions
+  {
+    /**
+     * @brief The maximum number of pages fetched in the background ahead of the page being
+     * consumed. 0 fetches each page only when it's asked for.
+     */
+    int PrefetchPages = 1;
+  };
+
+  /**
+   * @brief Iterates over the pages of a listing, following the continuation token each page
+   * returns. No request is sent until the first page is asked for. While a page is being
+   * consumed, the ones after it are fetched on the shared transfer executor, up to
+   * PagerOptions::PrefetchPages of them.
+   *
+   * @tparam T The result of a single page, which has a ContinuationToken.
+   */
+  template <class T> class Pager {
+  public:
+    /**
+     * @brief Fetches the page starting at a continuation token.
+     */
+    using PageFetcher = std::function<Azure::Core::Response<T>(
+        const Azure::Core::Nullable<std::string>& continuationToken,
+        const Azure::Core::Context& context)>;
+
+    /**
+     * @brief Initializes a new instance of Pager.
+     *
+     * @param fetcher Fetches a page, called on executor threads when prefetching.
+     * @param continuationToken The continuation token of the first page, null to start from the
+     * beginning.
+     * @param options Optional parameters of the pager.
+     * @param context Context for the page requests. The pager cancels its requests when
+     * destroyed.
+     */
+    explicit Pager(
+        PageFetcher fetcher,
+        Azure::Core::Nullable<std::string> continuationToken,
+        const PagerOptions& options,
+        const Azure::Core::Context& context)
+        : m_state(std::make_shared<State>())
+    {
+      m_state->Fetcher = std::move(fetcher);
+      m_state->PagerContext = context.WithDeadline(Azure::Core::Context::time_point::max());
+      m_state->PrefetchPages
+          = options.PrefetchPages > 0 ? static_cast<std::size_t>(options.PrefetchPages) : 0;
+      m_state->NextToken = std::move(continuationToken);
+    }
+
+    Pager(Pager&& other) = default;
+
+    Pager& operator=(Pager&& other)
+    {
+      if (this != &other)
+      {
+        Stop();
+        m_state = std::move(other.m_state);
+        m_page = std::move(other.m_page);
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Cancels the requests in flight and waits for them to return.
+     */
+    ~Pager() { Stop(); }
+
+    /**
+     * @brief Moves to the next page, waiting for it to arrive if it's still being fetched. The
+     * previous page is released.
+     *
+     * @return false if there are no more pages.
+     * @throw The exception fetching the page threw, after which there are no more pages.
+     */
+    bool NextPage()
+    {
+      m_page.reset();
+      std::unique_lock<std::mutex> lock(m_state->Mutex);
+      while (m_state->Pages.empty())
+      {
+        if (m_state->Error)
+        {
+          std::exception_ptr error = std::move(m_state->Error);
+          m_state->Error = nullptr;
+          std::rethrow_exception(error);
+        }
+        if (m_state->Done)
+        {
+          return false;
+        }
+        if (m_state->Status == FetchStatus::Running)
+        {
+          m_state->Cv.wait(lock);
+        }
+        else
+        {
+          // nobody has picked up the fetch yet, or prefetching is off
+          m_state->Status = FetchStatus::Running;
+          lock.unlock();
+          Fetch(m_state);
+          lock.lock();
+        }
+      }
+      m_page = std::make_unique<Azure::Core::Response<T>>(std::move(m_state->Pages.front()));
+      m_state->Pages.pop_front();
+      SchedulePrefetch(m_state, lock);
+      return true;
+    }
+
+    /**
+     * @brief Gets the page NextPage moved to.
+     */
+    Azure::Core::Response<T>& CurrentPage() { return *m_page; }
+
+  private:
+    enum class FetchStatus
+    {
+      Idle,
+      Queued,
+      Running,
+    };
+
+    struct State
+    {
+      PageFetcher Fetcher;
+      Azure::Core::Context PagerContext;
+      std::size_t PrefetchPages = 0;
+
+      std::mutex Mutex;
+      std::condition_variable Cv;
+      // protected by Mutex
+      Azure::Core::Nullable<std::string> NextToken;
+      std::deque<Azure::Core::Response<T>> Pages;
+      std::exception_ptr Error;
+      FetchStatus Status = FetchStatus::Idle;
+      bool Done = false;
+    };
+
+    // Fetches the page at NextToken. Must be called with Status set to Running.
+    static void Fetch(const std::shared_ptr<State>& state)
+    {
+      Azure::Core::Nullable<std::string> token;
+      {
+        std::lock_guard<std::mutex> guard(state->Mutex);
+        token = state->NextToken;
+      }
+
+      std::unique_ptr<Azure::Core::Response<T>> page;
+      std::exception_ptr error;
+      try
+      {
+        page = std::make_unique<Azure::Core::Response<T>>(
+            state->Fetcher(token, state->PagerContext));
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+
+      std::unique_lock<std::mutex> lock(state->Mutex);
+      if (error)
+      {
+        state->Error = std::move(error);
+        state->Done = true;
+      }
+      else
+      {
+        state->NextToken = (*page)->ContinuationToken;
+        // the pager may have been stopped while the page was being fetched
+        state->Done = state->Done || !state->NextToken.HasValue()
+            || state->NextToken.GetValue().empty();
+        state->Pages.push_back(std::move(*page));
+      }
+      state->Status = FetchStatus::Idle;
+      state->Cv.notify_all();
+      SchedulePrefetch(state, lock);
+    }
+
+    static void SchedulePrefetch(
+        const std::shared_ptr<State>& state,
+        std::unique_lock<std::mutex>& lock)
+    {
+      if (state->Status != FetchStatus::Idle || state->Done
+          || state->Pages.size() >= state->PrefetchPages)
+      {
+        return;
+      }
+      state->Status = FetchStatus::Queued;
+      lock.unlock();
+      Details::TransferExecutor::GetDefault().Submit([state]() {
+        {
+          std::lock_guard<std::mutex> guard(state->Mutex);
+          // the consumer may have run it already
+          if (state->Status != FetchStatus::Queued)
+          {
+            return;
+          }
+          state->Status = FetchStatus::Running;
+        }
+        Fetch(state);
+      });
+      lock.lock();
+    }
+
+    void Stop()
+    {
+      if (!m_state)
+      {
+        return;
+      }
+      m_state->PagerContext.Cancel();
+      std::unique_lock<std::mutex> lock(m_state->Mutex);
+      m_state->Done = true;
+      if (m_state->Status == FetchStatus::Queued)
+      {
+        m_state->Status = FetchStatus::Idle;
+      }
+      m_state->Cv.wait(lock, [this]() { return m_state->Status != FetchStatus::Running; });
+      m_state->Pages.clear();
+    }
+
+    std::shared_ptr<State> m_state;
+    std::unique_ptr<Azure::Core::Response<T>> m_page;
+  };
+
+}} // namespace Azure::Storage
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <azure/core/http/http.hpp>
+#include <azure/core/response.hpp>
+
+#include "azure/storage/common/constants.hpp"
+#include "azure/storage/common/storage_exception.hpp"
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief The outcome of an operation that doesn't throw when the service fails it. Holds either
+   * the response of the operation or the raw response of the failure. The error body is only
+   * parsed when #GetError is called.
+   *
+   * @remark Failures to send the request, such as connection errors, are still thrown.
+   *
+   * @tparam T The result of the operation.
+   */
+  template <class T> class StorageResult {
+  public:
+    /**
+     * @brief Initializes a new instance of StorageResult.
+     *
+     * @param response The response of the operation, without a value if the service failed it.
+     */
+    explicit StorageResult(Azure::Core::Response<T> response) : m_response(std::move(response)) {}
+
+    /**
+     * @brief Checks whether the operation succeeded.
+     */
+    bool HasValue() const noexcept { return m_response.HasValue(); }
+
+    /**
+     * @brief Checks whether the operation succeeded.
+     */
+    explicit operator bool() const noexcept { return HasValue(); }
+
+    /**
+     * @brief Gets the result of the operation, which must have succeeded.
+     */
+    const T* operator->() const { return m_response.operator->(); }
+
+    /**
+     * @brief Gets the result of the operation, which must have succeeded.
+     */
+    T* operator->() { return m_response.operator->(); }
+
+    /**
+     * @brief Gets the result of the operation, which must have succeeded.
+     */
+    const T& operator*() const { return *m_response; }
+
+    /**
+     * @brief Gets the result of the operation, which must have succeeded.
+     */
+    T& operator*() { return *m_response; }
+
+    /**
+     * @brief Gets the raw HTTP response of the operation, whether it succeeded or not.
+     */
+    Azure::Core::Http::RawResponse& GetRawResponse()
+    {
+      return m_error ? *m_error->RawResponse : m_response.GetRawResponse();
+    }
+
+    /**
+     * @brief Gets the HTTP status code of the response.
+     */
+    Azure::Core::Http::HttpStatusCode GetStatusCode() { return GetRawResponse().GetStatusCode(); }
+
+    /**
+     * @brief Gets the request ID the service assigned to the operation.
+     *
+     * @return The request ID, empty if the response doesn't have one.
+     */
+    std::string GetRequestId()
+    {
+      const auto& headers = GetRawResponse().GetHeaders();
+      auto requestId = headers.find(Details::HttpHeaderRequestId);
+      return requestId == headers.end() ? std::string() : requestId->second;
+    }
+
+    /**
+     * @brief Gets the storage error code of a failed operation. It's read from the response
+     * headers, the error body is only parsed if they don't have it.
+     *
+     * @return The error code, empty if the operation succeeded.
+     */
+    std::string GetErrorCode()
+    {
+      if (HasValue())
+      {
+        return std::string();
+      }
+      const auto& headers = GetRawResponse().GetHeaders();
+      auto errorCode = headers.find(Details::HttpHeaderErrorCode);
+      if (errorCode != headers.end())
+      {
+        return errorCode->second;
+      }
+      return GetError().ErrorCode;
+    }
+
+    /**
+     * @brief Gets the exception the operation would have thrown, parsing the error body the first
+     * time it's called. The operation must have failed.
+     */
+    StorageException& GetError()
+    {
+      if (!m_error)
+      {
+        m_error = std::make_unique<StorageException>(
+            StorageException::CreateFromResponse(m_response.ExtractRawResponse()));
+      }
+      return *m_error;
+    }
+
+    /**
+     * @brief Moves out the response of the operation.
+     *
+     * @throw StorageException if the operation failed.
+     */
+    Azure::Core::Response<T> ExtractResponse()
+    {
+      if (!HasValue())
+      {
+        GetError();
+        throw std::move(*m_error);
+      }
+      return std::move(m_response);
+    }
+
+    /**
+     * @brief Moves out the raw HTTP response of the operation, whether it succeeded or not.
+     */
+    std::unique_ptr<Azure::Core::Http::RawResponse> ExtractRawResponse()
+    {
+      return m_error ? std::move(m_error->RawResponse) : m_response.ExtractRawResponse();
+    }
+
+  private:
+    Azure::Core::Response<T> m_response;
+    std::unique_ptr<StorageException> m_error;
+  };
+
+}} // namespace Azure::Storage
@@ -5,6 +5,10 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/body_stream.hpp>
 
 namespace Azure { namespace Storage { namespace Details {
 
@@ -29,18 +33,54 @@ namespace Azure { namespace Storage { namespace Details {
     const char* Value;
   };
 
+  /**
+   * @brief Pull parser for the subset of XML that storage services return.
+   *
+   * @remark The document is copied once. Names and values returned in #XmlNode point into that
+   * copy, terminated and entity-decoded in place, and stay valid for the lifetime of the reader.
+   */
   class XmlReader {
   public:
     explicit XmlReader(const char* data, std::size_t length);
+
+    /**
+     * @brief Constructs a reader that parses the document while it's being read from a stream.
+     *
+     * @remark Only the part of the document that hasn't been parsed yet is buffered, so names and
+     * values returned in #XmlNode stay valid until the next call to #Read.
+     */
+    explicit XmlReader(Azure::Core::Http::BodyStream& stream, const Azure::Core::Context& context);
     ~XmlReader();
 
     XmlNode Read();
 
   private:
-    void* m_reader = nullptr;
+    bool HasCompleteToken() const;
+    bool ReadFromStream();
+
+    std::string m_buffer;
+    Azure::Core::Http::BodyStream* m_stream = nullptr;
+    Azure::Core::Context m_context;
+    std::vector<uint8_t> m_streamBuffer;
+    std::size_t m_cursor = 0;
+    // the '<' at m_cursor was overwritten to terminate the text before it
+    bool m_atTag = false;
+    bool m_lastWasStartTag = false;
+    bool m_rootSeen = false;
     bool m_readingAttributes = false;
+    std::size_t m_attributesCursor = 0;
+    std::size_t m_attributesEnd = 0;
+    // names of the open elements, each one terminated, and where each of them starts
+    std::string m_openTags;
+    std::vector<std::size_t> m_openTagOffsets;
   };
 
+  /**
+   * @brief Writes an XML document into a string.
+   *
+   * @remark Like the reader, it only supports what storage requests need: elements, attributes
+   * and text, in UTF-8.
+   */
   class XmlWriter {
   public:
     explicit XmlWriter();
@@ -48,11 +88,20 @@ namespace Azure { namespace Storage { namespace Details {
 
     void Write(XmlNode node);
 
+    /**
+     * @brief Returns what has been written so far and leaves the writer empty.
+     */
     std::string GetDocument();
 
   private:
-    void* m_buffer = nullptr;
-    void* m_writer = nullptr;
+    void CloseStartTag();
+
+    std::string m_document;
+    // names of the open elements, each one terminated, and where each of them starts
+    std::string m_openTags;
+    std::vector<std::size_t> m_openTagOffsets;
+    // the last start tag can still take attributes, or become an empty element
+    bool m_startTagOpen = false;
   };
 
 }}} // namespace Azure::Storage::Details
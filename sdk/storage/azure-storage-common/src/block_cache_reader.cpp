@@ -0,0 +1,283 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/block_cache_reader.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <system_error>
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+
+namespace Azure { namespace Storage { namespace Details {
+
+  BlockCacheReader::BlockCacheReader(
+      int64_t size,
+      int64_t blockSize,
+      int64_t cacheSize,
+      int64_t maxRequestSize,
+      int concurrency,
+      RangeFetcher fetcher)
+      : m_size(size), m_blockSize(std::max(blockSize, int64_t(1))), m_cacheSize(cacheSize),
+        m_blocksPerRequest(std::max(maxRequestSize / m_blockSize, int64_t(1))),
+        m_concurrency(std::max(concurrency, 1)), m_fetcher(std::move(fetcher))
+  {
+  }
+
+  int64_t BlockCacheReader::ReadAt(
+      int64_t offset,
+      uint8_t* buffer,
+      int64_t count,
+      const Azure::Core::Context& context)
+  {
+    if (count <= 0 || offset >= m_size)
+    {
+      return 0;
+    }
+    count = std::min(count, m_size - offset);
+
+    const int64_t firstBlockId = offset / m_blockSize;
+    const int64_t lastBlockId = (offset + count - 1) / m_blockSize;
+    std::vector<std::shared_ptr<Block>> blocks;
+    std::vector<Run> missingRuns;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      for (int64_t blockId = firstBlockId; blockId <= lastBlockId; ++blockId)
+      {
+        blocks.push_back(AcquireBlock(blockId, missingRuns));
+      }
+    }
+
+    FetchRuns(missingRuns, context);
+
+    int64_t bytesRead = 0;
+    for (std::size_t i = 0; i < blocks.size(); ++i)
+    {
+      auto& block = blocks[i];
+      const int64_t blockId = firstBlockId + static_cast<int64_t>(i);
+      {
+        // The block may be fetched by another read or a prefetch, whose context isn't ours.
+        std::unique_lock<std::mutex> guard(m_mutex);
+        while (!block->Ready)
+        {
+          if (block->Error)
+          {
+            // Our own fetches threw above, so the failed fetch was someone else's. Their context
+            // may have been cancelled, or the prefetch hit an error a new request won't.
+            std::vector<Run> retryRuns;
+            block = AcquireBlock(blockId, retryRuns);
+            guard.unlock();
+            FetchRuns(retryRuns, context);
+            guard.lock();
+            continue;
+          }
+          context.ThrowIfCancelled();
+          m_cv.wait_for(guard, std::chrono::milliseconds(10));
+        }
+        auto ite = m_blocks.find(blockId);
+        if (ite != m_blocks.end() && ite->second == block)
+        {
+          m_lru.splice(m_lru.begin(), m_lru, block->LruPosition);
+        }
+      }
+
+      const int64_t blockOffset = blockId * m_blockSize;
+      const int64_t begin = std::max(offset, blockOffset) - blockOffset;
+      const int64_t end = std::min(offset + count, blockOffset + m_blockSize) - blockOffset;
+      std::memcpy(
+          buffer + bytesRead,
+          block->Data.data() + begin,
+          static_cast<std::size_t>(end - begin));
+      bytesRead += end - begin;
+    }
+    return bytesRead;
+  }
+
+  void BlockCacheReader::Prefetch(const std::vector<std::pair<int64_t, int64_t>>& ranges)
+  {
+    std::vector<int64_t> blockIds;
+    for (const auto& range : ranges)
+    {
+      const int64_t offset = std::max(range.first, int64_t(0));
+      const int64_t end = std::min(range.first + range.second, m_size);
+      for (int64_t blockId = offset / m_blockSize; blockId * m_blockSize < end; ++blockId)
+      {
+        blockIds.push_back(blockId);
+      }
+    }
+    std::sort(blockIds.begin(), blockIds.end());
+    blockIds.erase(std::unique(blockIds.begin(), blockIds.end()), blockIds.end());
+
+    auto missingRuns = std::make_shared<std::vector<Run>>();
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      for (int64_t blockId : blockIds)
+      {
+        AcquireBlock(blockId, *missingRuns);
+      }
+    }
+    if (missingRuns->empty())
+    {
+      return;
+    }
+
+    auto self = shared_from_this();
+    try
+    {
+      TransferExecutor::GetDefault().Submit([self, missingRuns]() {
+        try
+        {
+          self->FetchRuns(*missingRuns, Azure::Core::Context());
+        }
+        catch (...)
+        {
+          // Reads of the failed blocks will fetch them again.
+        }
+      });
+    }
+    catch (std::system_error&)
+    {
+      auto error = std::current_exception();
+      for (auto& run : *missingRuns)
+      {
+        FailRun(run, error);
+      }
+    }
+  }
+
+  std::shared_ptr<BlockCacheReader::Block> BlockCacheReader::AcquireBlock(
+      int64_t blockId,
+      std::vector<Run>& missingRuns)
+  {
+    auto ite = m_blocks.find(blockId);
+    if (ite != m_blocks.end())
+    {
+      return ite->second;
+    }
+
+    auto block = std::make_shared<Block>();
+    m_blocks.emplace(blockId, block);
+    if (missingRuns.empty()
+        || missingRuns.back().FirstBlockId
+                + static_cast<int64_t>(missingRuns.back().Blocks.size())
+            != blockId
+        || static_cast<int64_t>(missingRuns.back().Blocks.size()) == m_blocksPerRequest)
+    {
+      missingRuns.emplace_back();
+      missingRuns.back().FirstBlockId = blockId;
+    }
+    missingRuns.back().Blocks.push_back(block);
+    return block;
+  }
+
+  void BlockCacheReader::FetchRuns(std::vector<Run>& runs, const Azure::Core::Context& context)
+  {
+    try
+    {
+      if (runs.size() == 1)
+      {
+        FetchRun(runs[0], context);
+      }
+      else if (runs.size() > 1)
+      {
+        ConcurrentTransfer(
+            0,
+            static_cast<int64_t>(runs.size()),
+            1,
+            m_concurrency,
+            [this, &runs, &context](int64_t runId, int64_t, int64_t, int64_t) {
+              FetchRun(runs[static_cast<std::size_t>(runId)], context);
+            },
+            context);
+      }
+    }
+    catch (...)
+    {
+      // Readers waiting on blocks that didn't make it get the error.
+      auto error = std::current_exception();
+      for (auto& run : runs)
+      {
+        if (!run.Done)
+        {
+          FailRun(run, error);
+        }
+      }
+      throw;
+    }
+  }
+
+  void BlockCacheReader::FetchRun(Run& run, const Azure::Core::Context& context)
+  {
+    const int64_t offset = run.FirstBlockId * m_blockSize;
+    const int64_t length
+        = std::min(m_size - offset, static_cast<int64_t>(run.Blocks.size()) * m_blockSize);
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(length));
+    m_fetcher(offset, length, buffer.data(), context);
+
+    if (run.Blocks.size() == 1)
+    {
+      run.Blocks[0]->Data = std::move(buffer);
+    }
+    else
+    {
+      for (std::size_t i = 0; i < run.Blocks.size(); ++i)
+      {
+        const int64_t begin = static_cast<int64_t>(i) * m_blockSize;
+        const int64_t end = std::min(begin + m_blockSize, length);
+        run.Blocks[i]->Data.assign(buffer.begin() + begin, buffer.begin() + end);
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      for (std::size_t i = 0; i < run.Blocks.size(); ++i)
+      {
+        const auto& block = run.Blocks[i];
+        const int64_t blockId = run.FirstBlockId + static_cast<int64_t>(i);
+        block->Ready = true;
+        auto ite = m_blocks.find(blockId);
+        if (ite != m_blocks.end() && ite->second == block)
+        {
+          m_lru.push_front(blockId);
+          block->LruPosition = m_lru.begin();
+          m_cachedBytes += static_cast<int64_t>(block->Data.size());
+        }
+      }
+      run.Done = true;
+      Evict();
+    }
+    m_cv.notify_all();
+  }
+
+  void BlockCacheReader::FailRun(Run& run, std::exception_ptr error)
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      for (std::size_t i = 0; i < run.Blocks.size(); ++i)
+      {
+        const auto& block = run.Blocks[i];
+        block->Error = error;
+        auto ite = m_blocks.find(run.FirstBlockId + static_cast<int64_t>(i));
+        if (ite != m_blocks.end() && ite->second == block)
+        {
+          m_blocks.erase(ite);
+        }
+      }
+      run.Done = true;
+    }
+    m_cv.notify_all();
+  }
+
+  void BlockCacheReader::Evict()
+  {
+    while (m_cachedBytes > m_cacheSize && !m_lru.empty())
+    {
+      auto ite = m_blocks.find(m_lru.back());
+      m_cachedBytes -= static_cast<int64_t>(ite->second->Data.size());
+      m_blocks.erase(ite);
+      m_lru.pop_back();
+    }
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -0,0 +1,431 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <utility>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    // Transfers are mostly waiting on the network, so we allow more threads than cores.
+    constexpr std::size_t MinTransferExecutorThreads = 64;
+    constexpr std::size_t TransferExecutorThreadsPerCore = 8;
+
+    thread_local TransferExecutor* CurrentExecutor = nullptr;
+    thread_local std::size_t CurrentWorkerId = 0;
+
+    struct TransferState
+    {
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      int64_t ChunkSize = 0;
+      int64_t NumChunks = 0;
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> TransferFunc;
+      Azure::Core::Context TransferContext;
+
+      std::atomic<int64_t> NextChunkId{0};
+      std::atomic<bool> Failed{false};
+      // Only written by the worker that sets Failed.
+      std::exception_ptr FirstError;
+
+      std::mutex Mutex;
+      std::condition_variable Cv;
+      // protected by Mutex
+      int NumRunningHelpers = 0;
+      bool Closed = false;
+
+      void Run()
+      {
+        while (true)
+        {
+          int64_t chunkId = NextChunkId.fetch_add(1);
+          if (chunkId >= NumChunks || Failed)
+          {
+            break;
+          }
+          int64_t chunkOffset = Offset + ChunkSize * chunkId;
+          int64_t chunkLength = std::min(Length - ChunkSize * chunkId, ChunkSize);
+          try
+          {
+            TransferContext.ThrowIfCancelled();
+            TransferFunc(chunkOffset, chunkLength, chunkId, NumChunks);
+          }
+          catch (...)
+          {
+            if (Failed.exchange(true) == false)
+            {
+              FirstError = std::current_exception();
+            }
+            break;
+          }
+        }
+      }
+
+      void RunHelper()
+      {
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          if (Closed)
+          {
+            // The transfer already finished before this helper got a thread.
+            return;
+          }
+          ++NumRunningHelpers;
+        }
+        Run();
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          --NumRunningHelpers;
+        }
+        Cv.notify_all();
+      }
+    };
+
+    struct TreeWalkState
+    {
+      std::function<
+          void(const std::string&, int, std::vector<std::string>&, const Azure::Core::Context&)>
+          WalkFunc;
+      Azure::Core::Context WalkContext;
+
+      std::mutex Mutex;
+      std::condition_variable Cv;
+      // protected by Mutex
+      std::vector<std::pair<std::string, int>> Directories;
+      int NumWalking = 0;
+      std::exception_ptr FirstError;
+      int NumRunningHelpers = 0;
+      bool Closed = false;
+
+      void Run()
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        while (!FirstError)
+        {
+          if (Directories.empty())
+          {
+            if (NumWalking == 0)
+            {
+              break;
+            }
+            // the directories being walked may still turn up subdirectories
+            Cv.wait(lock);
+            continue;
+          }
+          auto directory = std::move(Directories.back());
+          Directories.pop_back();
+          ++NumWalking;
+          lock.unlock();
+
+          std::vector<std::string> subdirectories;
+          std::exception_ptr error;
+          try
+          {
+            WalkContext.ThrowIfCancelled();
+            WalkFunc(directory.first, directory.second, subdirectories, WalkContext);
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+
+          lock.lock();
+          --NumWalking;
+          if (error && !FirstError)
+          {
+            FirstError = error;
+            // stop the other workers' requests too
+            WalkContext.Cancel();
+          }
+          for (auto& subdirectory : subdirectories)
+          {
+            Directories.emplace_back(std::move(subdirectory), directory.second + 1);
+          }
+          Cv.notify_all();
+        }
+      }
+
+      void RunHelper()
+      {
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          if (Closed)
+          {
+            return;
+          }
+          ++NumRunningHelpers;
+        }
+        Run();
+        {
+          std::lock_guard<std::mutex> guard(Mutex);
+          --NumRunningHelpers;
+        }
+        Cv.notify_all();
+      }
+    };
+  } // namespace
+
+  TransferExecutor& TransferExecutor::GetDefault()
+  {
+    // Intentionally never destroyed, worker threads may still be parked at process exit.
+    static TransferExecutor* executor = new TransferExecutor(std::max(
+        MinTransferExecutorThreads,
+        TransferExecutorThreadsPerCore * std::thread::hardware_concurrency()));
+    return *executor;
+  }
+
+  TransferExecutor::TransferExecutor(std::size_t maxThreads)
+  {
+    maxThreads = std::max(maxThreads, static_cast<std::size_t>(1));
+    m_workers.reserve(maxThreads);
+    for (std::size_t i = 0; i < maxThreads; ++i)
+    {
+      m_workers.emplace_back(std::make_unique<Worker>());
+    }
+  }
+
+  TransferExecutor::~TransferExecutor()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_stopped = true;
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+      if (worker->Thread.joinable())
+      {
+        worker->Thread.join();
+      }
+    }
+  }
+
+  void TransferExecutor::Submit(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      std::size_t workerId;
+      if (CurrentExecutor == this)
+      {
+        // Tasks submitted from a worker go to its own queue, other workers can steal them.
+        workerId = CurrentWorkerId;
+      }
+      else if (m_numIdleThreads <= m_numPendingTasks && m_numThreads < m_workers.size())
+      {
+        workerId = m_numThreads;
+        m_workers[workerId]->Thread = std::thread([this, workerId]() { WorkerFunc(workerId); });
+        ++m_numThreads;
+      }
+      else
+      {
+        workerId = m_nextWorker++ % m_numThreads;
+      }
+      {
+        std::lock_guard<std::mutex> workerGuard(m_workers[workerId]->Mutex);
+        m_workers[workerId]->Tasks.push_back(std::move(task));
+      }
+      ++m_numPendingTasks;
+    }
+    m_cv.notify_one();
+  }
+
+  void TransferExecutor::WorkerFunc(std::size_t workerId)
+  {
+    CurrentExecutor = this;
+    CurrentWorkerId = workerId;
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        ++m_numIdleThreads;
+        m_cv.wait(guard, [this]() { return m_numPendingTasks != 0 || m_stopped; });
+        --m_numIdleThreads;
+        if (m_numPendingTasks == 0)
+        {
+          return;
+        }
+        // Reserves one of the queued tasks, TakeTask() is guaranteed to find it.
+        --m_numPendingTasks;
+      }
+      auto task = TakeTask(workerId);
+      task();
+    }
+  }
+
+  std::function<void()> TransferExecutor::TakeTask(std::size_t workerId)
+  {
+    while (true)
+    {
+      {
+        auto& self = *m_workers[workerId];
+        std::lock_guard<std::mutex> guard(self.Mutex);
+        if (!self.Tasks.empty())
+        {
+          auto task = std::move(self.Tasks.back());
+          self.Tasks.pop_back();
+          return task;
+        }
+      }
+      for (std::size_t i = 1; i < m_workers.size(); ++i)
+      {
+        auto& victim = *m_workers[(workerId + i) % m_workers.size()];
+        std::lock_guard<std::mutex> guard(victim.Mutex);
+        if (!victim.Tasks.empty())
+        {
+          auto task = std::move(victim.Tasks.front());
+          victim.Tasks.pop_front();
+          return task;
+        }
+      }
+      // Another worker stole the task we reserved, but then its own reservation is still queued.
+      std::this_thread::yield();
+    }
+  }
+
+  void TransferTask::State::TryRun()
+  {
+    Status expected = Status::Queued;
+    if (!TaskStatus.compare_exchange_strong(expected, Status::Running))
+    {
+      return;
+    }
+    try
+    {
+      Func();
+    }
+    catch (...)
+    {
+      Error = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> guard(Mutex);
+      TaskStatus = Status::Finished;
+    }
+    Cv.notify_all();
+  }
+
+  TransferTask::TransferTask(std::function<void()> func) : m_state(std::make_shared<State>())
+  {
+    m_state->Func = std::move(func);
+    try
+    {
+      auto state = m_state;
+      TransferExecutor::GetDefault().Submit([state]() { state->TryRun(); });
+    }
+    catch (std::system_error&)
+    {
+      // No thread available, the task will be run by Wait().
+    }
+  }
+
+  TransferTask::~TransferTask() { WaitFinished(); }
+
+  void TransferTask::WaitFinished()
+  {
+    m_state->TryRun();
+    std::unique_lock<std::mutex> guard(m_state->Mutex);
+    m_state->Cv.wait(guard, [this]() { return m_state->TaskStatus == State::Status::Finished; });
+  }
+
+  void TransferTask::Wait()
+  {
+    WaitFinished();
+    if (m_state->Error)
+    {
+      std::rethrow_exception(m_state->Error);
+    }
+  }
+
+  void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      const Azure::Core::Context& context)
+  {
+    // Helpers that are still queued when the transfer finishes outlive this call, so everything
+    // they touch lives in a shared state.
+    auto state = std::make_shared<TransferState>();
+    state->Offset = offset;
+    state->Length = length;
+    state->ChunkSize = chunkSize;
+    state->NumChunks = (length + chunkSize - 1) / chunkSize;
+    state->TransferFunc = std::move(transferFunc);
+    state->TransferContext = context;
+
+    const int64_t numHelpers = std::min(static_cast<int64_t>(concurrency), state->NumChunks) - 1;
+    auto& executor = TransferExecutor::GetDefault();
+    for (int64_t i = 0; i < numHelpers; ++i)
+    {
+      try
+      {
+        executor.Submit([state]() { state->RunHelper(); });
+      }
+      catch (std::system_error&)
+      {
+        // Failed to start a thread, the threads we already have will do the rest.
+        break;
+      }
+    }
+
+    state->Run();
+
+    {
+      std::unique_lock<std::mutex> guard(state->Mutex);
+      state->Closed = true;
+      state->Cv.wait(guard, [&state]() { return state->NumRunningHelpers == 0; });
+    }
+
+    if (state->FirstError)
+    {
+      std::rethrow_exception(state->FirstError);
+    }
+  }
+
+  void ConcurrentTreeWalk(
+      std::string root,
+      int concurrency,
+      std::function<
+          void(const std::string&, int, std::vector<std::string>&, const Azure::Core::Context&)>
+          walkFunc,
+      const Azure::Core::Context& context)
+  {
+    auto state = std::make_shared<TreeWalkState>();
+    state->WalkFunc = std::move(walkFunc);
+    state->WalkContext = context.WithDeadline(Azure::Core::Context::time_point::max());
+    state->Directories.emplace_back(std::move(root), 0);
+
+    auto& executor = TransferExecutor::GetDefault();
+    for (int i = 1; i < concurrency; ++i)
+    {
+      try
+      {
+        executor.Submit([state]() { state->RunHelper(); });
+      }
+      catch (std::system_error&)
+      {
+        break;
+      }
+    }
+
+    state->Run();
+
+    {
+      std::unique_lock<std::mutex> guard(state->Mutex);
+      state->Closed = true;
+      state->Cv.wait(guard, [&state]() { return state->NumRunningHelpers == 0; });
+    }
+
+    if (state->FirstError)
+    {
+      std::rethrow_exception(state->FirstError);
+    }
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -16,17 +16,39 @@
 #elif defined(AZ_PLATFORM_POSIX)
 #include <openssl/bio.h>
 #include <openssl/buffer.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
 #include <openssl/sha.h>
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define AZ_STORAGE_CRC64_PCLMUL
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+#define AZ_STORAGE_CRC64_PCLMUL_TARGET __attribute__((target("pclmul,sse2")))
+#else
+#define AZ_STORAGE_CRC64_PCLMUL_TARGET
+#endif
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define AZ_STORAGE_CRC64_PMULL
+#include <arm_neon.h>
+#endif
+
 #include <algorithm>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
 #include <azure/core/http/http.hpp>
 
+#include "azure/storage/common/concurrent_transfer.hpp"
 #include "azure/storage/common/storage_common.hpp"
 
 namespace Azure { namespace Storage {
@@ -241,6 +263,67 @@ namespace Azure { namespace Storage {
 
       return hash;
     }
+
+    struct HmacSha256Context::State
+    {
+      BCRYPT_HASH_HANDLE Handle = nullptr;
+      std::string Object;
+      // Guards duplicating the keyed hash.
+      std::mutex Mutex;
+    };
+
+    HmacSha256Context::HmacSha256Context(const std::vector<uint8_t>& key)
+        : m_state(std::make_unique<State>())
+    {
+      static AlgorithmProviderInstance AlgorithmProvider(AlgorithmType::HmacSha256);
+
+      m_state->Object.resize(AlgorithmProvider.ContextSize);
+      NTSTATUS status = BCryptCreateHash(
+          AlgorithmProvider.Handle,
+          &m_state->Handle,
+          reinterpret_cast<PUCHAR>(&m_state->Object[0]),
+          static_cast<ULONG>(m_state->Object.size()),
+          reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(key.data())),
+          static_cast<ULONG>(key.size()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptCreateHash failed");
+      }
+    }
+
+    HmacSha256Context::~HmacSha256Context() { BCryptDestroyHash(m_state->Handle); }
+
+    void HmacSha256Context::Sign(const uint8_t* data, std::size_t length, uint8_t* hash) const
+    {
+      // The duplicate starts from the state the key left behind, its object is allocated by CNG.
+      BCRYPT_HASH_HANDLE hashHandle;
+      NTSTATUS status;
+      {
+        std::lock_guard<std::mutex> guard(m_state->Mutex);
+        status = BCryptDuplicateHash(m_state->Handle, &hashHandle, nullptr, 0, 0);
+      }
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptDuplicateHash failed");
+      }
+
+      status = BCryptHashData(
+          hashHandle,
+          reinterpret_cast<PBYTE>(const_cast<uint8_t*>(data)),
+          static_cast<ULONG>(length),
+          0);
+      if (BCRYPT_SUCCESS(status))
+      {
+        status = BCryptFinishHash(
+            hashHandle, reinterpret_cast<PUCHAR>(hash), static_cast<ULONG>(HashLength), 0);
+      }
+      BCryptDestroyHash(hashHandle);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptHashData failed");
+      }
+    }
   } // namespace Details
 
 #elif defined(AZ_PLATFORM_POSIX)
@@ -275,6 +358,102 @@ namespace Azure { namespace Storage {
       return std::vector<uint8_t>(std::begin(hash), std::begin(hash) + hashLength);
     }
 
+    struct HmacSha256Context::State
+    {
+      ~State()
+      {
+        EVP_MD_CTX_free(Inner);
+        EVP_MD_CTX_free(Outer);
+      }
+
+      EVP_MD_CTX* Inner = nullptr;
+      EVP_MD_CTX* Outer = nullptr;
+    };
+
+    namespace {
+      // Starts a SHA-256 context that has hashed the key XORed with padByte.
+      EVP_MD_CTX* NewPaddedKeyContext(const uint8_t (&paddedKey)[SHA256_CBLOCK], uint8_t padByte)
+      {
+        uint8_t pad[SHA256_CBLOCK];
+        std::transform(std::begin(paddedKey), std::end(paddedKey), pad, [padByte](uint8_t b) {
+          return static_cast<uint8_t>(b ^ padByte);
+        });
+        EVP_MD_CTX* context = EVP_MD_CTX_new();
+        const bool succeeded = context != nullptr
+            && EVP_DigestInit_ex(context, EVP_sha256(), nullptr) == 1
+            && EVP_DigestUpdate(context, pad, sizeof(pad)) == 1;
+        OPENSSL_cleanse(pad, sizeof(pad));
+        if (!succeeded)
+        {
+          EVP_MD_CTX_free(context);
+          throw std::runtime_error("failed to initialize HMAC-SHA256 context");
+        }
+        return context;
+      }
+
+      void FinishDigest(
+          EVP_MD_CTX* context,
+          const EVP_MD_CTX* state,
+          const uint8_t* data,
+          std::size_t length,
+          uint8_t* hash)
+      {
+        if (EVP_MD_CTX_copy_ex(context, state) != 1
+            || EVP_DigestUpdate(context, data, length) != 1
+            || EVP_DigestFinal_ex(context, hash, nullptr) != 1)
+        {
+          EVP_MD_CTX_free(context);
+          throw std::runtime_error("failed to compute HMAC-SHA256");
+        }
+      }
+    } // namespace
+
+    HmacSha256Context::HmacSha256Context(const std::vector<uint8_t>& key)
+        : m_state(std::make_unique<State>())
+    {
+      // RFC 2104, keys longer than the block size are hashed first.
+      uint8_t paddedKey[SHA256_CBLOCK] = {};
+      if (key.size() > sizeof(paddedKey))
+      {
+        if (EVP_Digest(key.data(), key.size(), paddedKey, nullptr, EVP_sha256(), nullptr) != 1)
+        {
+          throw std::runtime_error("failed to hash HMAC-SHA256 key");
+        }
+      }
+      else
+      {
+        std::copy(key.begin(), key.end(), paddedKey);
+      }
+
+      try
+      {
+        m_state->Inner = NewPaddedKeyContext(paddedKey, 0x36);
+        m_state->Outer = NewPaddedKeyContext(paddedKey, 0x5c);
+      }
+      catch (...)
+      {
+        OPENSSL_cleanse(paddedKey, sizeof(paddedKey));
+        throw;
+      }
+      OPENSSL_cleanse(paddedKey, sizeof(paddedKey));
+    }
+
+    HmacSha256Context::~HmacSha256Context() {}
+
+    void HmacSha256Context::Sign(const uint8_t* data, std::size_t length, uint8_t* hash) const
+    {
+      // The saved states are only read, each signature resumes from a copy of them.
+      EVP_MD_CTX* context = EVP_MD_CTX_new();
+      if (context == nullptr)
+      {
+        throw std::runtime_error("failed to allocate HMAC-SHA256 context");
+      }
+      uint8_t innerHash[SHA256_DIGEST_LENGTH];
+      FinishDigest(context, m_state->Inner, data, length, innerHash);
+      FinishDigest(context, m_state->Outer, innerHash, sizeof(innerHash), hash);
+      EVP_MD_CTX_free(context);
+    }
+
   } // namespace Details
 
 #endif
@@ -910,12 +1089,9 @@ namespace Azure { namespace Storage {
     return vr[0] ^ vr[1];
   }
 
-  void Crc64Hash::OnAppend(const uint8_t* data, std::size_t length)
+  // Slice-by-32 lookup, uCrc is the CRC register, that is without the final inversion.
+  static uint64_t Crc64UpdateTable(uint64_t uCrc, const uint8_t* data, std::size_t length)
   {
-    m_length += length;
-
-    uint64_t uCrc = m_context ^ ~0ULL;
-
     uint64_t pData = 0;
 
     size_t uStop = length - (length % 32);
@@ -1055,7 +1231,234 @@ namespace Azure { namespace Storage {
     {
       uCrc = (uCrc >> 8) ^ Crc64MU1[(uCrc ^ data[pData]) & 0xff];
     }
-    m_context = uCrc ^ ~0ULL;
+    return uCrc;
+  }
+
+  // x^n mod P in the bit-reflected form of the CRC register, where bit 63 is the coefficient of
+  // x^0.
+  static constexpr uint64_t Crc64XPowMod(unsigned int n)
+  {
+    uint64_t r = 1ULL << 63;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      r = (r >> 1) ^ ((r & 1) ? Crc64Poly : 0);
+    }
+    return r;
+  }
+
+#if defined(AZ_STORAGE_CRC64_PCLMUL) || defined(AZ_STORAGE_CRC64_PMULL)
+  /*
+   * Carry-less multiplication folding. A 128-bit block of the message loaded from memory is the
+   * polynomial H * x^64 + L, where H is its first eight bytes. Moving it d bits further down the
+   * message multiplies it by x^d, which modulo P is H * (x^(d+63) mod P) * x + L * (x^(d-1) mod P)
+   * * x. A carry-less product of two reflected 64-bit values comes out one bit short, which is the
+   * trailing * x, so folding a block over the next d bits is two multiplications and a XOR.
+   * Whatever is left after folding is at most 16 bytes and goes through the lookup table.
+   */
+  static constexpr uint64_t Crc64Fold128Lo = Crc64XPowMod(128 + 63);
+  static constexpr uint64_t Crc64Fold128Hi = Crc64XPowMod(128 - 1);
+  static constexpr uint64_t Crc64Fold256Lo = Crc64XPowMod(256 + 63);
+  static constexpr uint64_t Crc64Fold256Hi = Crc64XPowMod(256 - 1);
+  static constexpr uint64_t Crc64Fold384Lo = Crc64XPowMod(384 + 63);
+  static constexpr uint64_t Crc64Fold384Hi = Crc64XPowMod(384 - 1);
+  static constexpr uint64_t Crc64Fold512Lo = Crc64XPowMod(512 + 63);
+  static constexpr uint64_t Crc64Fold512Hi = Crc64XPowMod(512 - 1);
+#endif
+
+#if defined(AZ_STORAGE_CRC64_PCLMUL)
+  AZ_STORAGE_CRC64_PCLMUL_TARGET static inline __m128i Crc64Fold(__m128i a, __m128i k)
+  {
+    return _mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x00), _mm_clmulepi64_si128(a, k, 0x11));
+  }
+
+  AZ_STORAGE_CRC64_PCLMUL_TARGET static inline __m128i Crc64FoldConstant(uint64_t lo, uint64_t hi)
+  {
+    return _mm_set_epi64x(static_cast<int64_t>(hi), static_cast<int64_t>(lo));
+  }
+
+  AZ_STORAGE_CRC64_PCLMUL_TARGET static uint64_t Crc64UpdatePclmul(
+      uint64_t uCrc,
+      const uint8_t* data,
+      std::size_t length)
+  {
+    if (length < 64)
+    {
+      return Crc64UpdateTable(uCrc, data, length);
+    }
+
+    const __m128i* p = reinterpret_cast<const __m128i*>(data);
+    // Feeding the register into the first eight bytes is the same as starting from it.
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p), Crc64FoldConstant(uCrc, 0));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p += 4;
+    length -= 64;
+
+    const __m128i k512 = Crc64FoldConstant(Crc64Fold512Lo, Crc64Fold512Hi);
+    while (length >= 64)
+    {
+      x0 = _mm_xor_si128(Crc64Fold(x0, k512), _mm_loadu_si128(p));
+      x1 = _mm_xor_si128(Crc64Fold(x1, k512), _mm_loadu_si128(p + 1));
+      x2 = _mm_xor_si128(Crc64Fold(x2, k512), _mm_loadu_si128(p + 2));
+      x3 = _mm_xor_si128(Crc64Fold(x3, k512), _mm_loadu_si128(p + 3));
+      p += 4;
+      length -= 64;
+    }
+
+    const __m128i k128 = Crc64FoldConstant(Crc64Fold128Lo, Crc64Fold128Hi);
+    __m128i x = _mm_xor_si128(
+        _mm_xor_si128(
+            Crc64Fold(x0, Crc64FoldConstant(Crc64Fold384Lo, Crc64Fold384Hi)),
+            Crc64Fold(x1, Crc64FoldConstant(Crc64Fold256Lo, Crc64Fold256Hi))),
+        _mm_xor_si128(Crc64Fold(x2, k128), x3));
+    while (length >= 16)
+    {
+      x = _mm_xor_si128(Crc64Fold(x, k128), _mm_loadu_si128(p));
+      ++p;
+      length -= 16;
+    }
+
+    uint8_t folded[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), x);
+    uCrc = Crc64UpdateTable(0, folded, sizeof(folded));
+    return Crc64UpdateTable(uCrc, reinterpret_cast<const uint8_t*>(p), length);
+  }
+
+  static bool IsPclmulSupported()
+  {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 1)) != 0;
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_PCLMUL) != 0;
+#endif
+  }
+#elif defined(AZ_STORAGE_CRC64_PMULL)
+  static inline uint64x2_t Crc64Fold(uint64x2_t a, uint64x2_t k)
+  {
+    poly128_t lo = vmull_p64(
+        static_cast<poly64_t>(vgetq_lane_u64(a, 0)), static_cast<poly64_t>(vgetq_lane_u64(k, 0)));
+    poly128_t hi = vmull_p64(
+        static_cast<poly64_t>(vgetq_lane_u64(a, 1)), static_cast<poly64_t>(vgetq_lane_u64(k, 1)));
+    return veorq_u64(vreinterpretq_u64_p128(lo), vreinterpretq_u64_p128(hi));
+  }
+
+  static inline uint64x2_t Crc64FoldConstant(uint64_t lo, uint64_t hi)
+  {
+    return vcombine_u64(vcreate_u64(lo), vcreate_u64(hi));
+  }
+
+  static inline uint64x2_t Crc64Load(const uint8_t* data)
+  {
+    return vreinterpretq_u64_u8(vld1q_u8(data));
+  }
+
+  static uint64_t Crc64UpdatePmull(uint64_t uCrc, const uint8_t* data, std::size_t length)
+  {
+    if (length < 64)
+    {
+      return Crc64UpdateTable(uCrc, data, length);
+    }
+
+    // Feeding the register into the first eight bytes is the same as starting from it.
+    uint64x2_t x0 = veorq_u64(Crc64Load(data), Crc64FoldConstant(uCrc, 0));
+    uint64x2_t x1 = Crc64Load(data + 16);
+    uint64x2_t x2 = Crc64Load(data + 32);
+    uint64x2_t x3 = Crc64Load(data + 48);
+    data += 64;
+    length -= 64;
+
+    const uint64x2_t k512 = Crc64FoldConstant(Crc64Fold512Lo, Crc64Fold512Hi);
+    while (length >= 64)
+    {
+      x0 = veorq_u64(Crc64Fold(x0, k512), Crc64Load(data));
+      x1 = veorq_u64(Crc64Fold(x1, k512), Crc64Load(data + 16));
+      x2 = veorq_u64(Crc64Fold(x2, k512), Crc64Load(data + 32));
+      x3 = veorq_u64(Crc64Fold(x3, k512), Crc64Load(data + 48));
+      data += 64;
+      length -= 64;
+    }
+
+    const uint64x2_t k128 = Crc64FoldConstant(Crc64Fold128Lo, Crc64Fold128Hi);
+    uint64x2_t x = veorq_u64(
+        veorq_u64(
+            Crc64Fold(x0, Crc64FoldConstant(Crc64Fold384Lo, Crc64Fold384Hi)),
+            Crc64Fold(x1, Crc64FoldConstant(Crc64Fold256Lo, Crc64Fold256Hi))),
+        veorq_u64(Crc64Fold(x2, k128), x3));
+    while (length >= 16)
+    {
+      x = veorq_u64(Crc64Fold(x, k128), Crc64Load(data));
+      data += 16;
+      length -= 16;
+    }
+
+    uint8_t folded[16];
+    vst1q_u8(folded, vreinterpretq_u8_u64(x));
+    uCrc = Crc64UpdateTable(0, folded, sizeof(folded));
+    return Crc64UpdateTable(uCrc, data, length);
+  }
+#endif
+
+  using Crc64UpdateFunc = uint64_t (*)(uint64_t, const uint8_t*, std::size_t);
+
+  static Crc64UpdateFunc SelectCrc64Update()
+  {
+#if defined(AZ_STORAGE_CRC64_PCLMUL)
+    if (IsPclmulSupported())
+    {
+      return Crc64UpdatePclmul;
+    }
+    return Crc64UpdateTable;
+#elif defined(AZ_STORAGE_CRC64_PMULL)
+    // Only built when the target is known to have the crypto extension.
+    return Crc64UpdatePmull;
+#else
+    return Crc64UpdateTable;
+#endif
+  }
+
+  void Crc64Hash::OnAppend(const uint8_t* data, std::size_t length)
+  {
+    static const Crc64UpdateFunc Crc64Update = SelectCrc64Update();
+
+    m_length += length;
+    m_context = Crc64Update(m_context ^ ~0ULL, data, length) ^ ~0ULL;
+  }
+
+  void Crc64Hash::ParallelAppend(const uint8_t* data, std::size_t length, int concurrency)
+  {
+    // Smaller slices aren't worth a thread.
+    constexpr std::size_t MinSliceSize = 4 * 1024 * 1024;
+
+    if (concurrency <= 1 || length < 2 * MinSliceSize || data == nullptr)
+    {
+      Append(data, length);
+      return;
+    }
+    // Throws if Final() has been called.
+    Append(data, 0);
+
+    const std::size_t numSlices
+        = std::min(static_cast<std::size_t>(concurrency), length / MinSliceSize);
+    const std::size_t sliceSize = (length + numSlices - 1) / numSlices;
+    std::vector<Crc64Hash> partials((length + sliceSize - 1) / sliceSize);
+    Details::ConcurrentTransfer(
+        0,
+        static_cast<int64_t>(length),
+        static_cast<int64_t>(sliceSize),
+        concurrency,
+        [data, &partials](int64_t offset, int64_t sliceLength, int64_t sliceId, int64_t) {
+          partials[static_cast<std::size_t>(sliceId)].Append(
+              data + offset, static_cast<std::size_t>(sliceLength));
+        },
+        Azure::Core::Context());
+    for (const auto& partial : partials)
+    {
+      Concatenate(partial);
+    }
   }
 
   void Crc64Hash::Concatenate(const Crc64Hash& other)
@@ -3,6 +3,7 @@
 
 #include "azure/storage/common/file_io.hpp"
 
+#include <azure/core/exception.hpp>
 #include <azure/core/platform.hpp>
 
 #if defined(AZ_PLATFORM_POSIX)
@@ -12,10 +13,15 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <codecvt>
 #include <limits>
 #include <locale>
+#include <memory>
 #include <stdexcept>
+#include <vector>
+
+#include "azure/storage/common/concurrent_transfer.hpp"
 
 namespace Azure { namespace Storage { namespace Details {
 
@@ -150,4 +156,48 @@ namespace Azure { namespace Storage { namespace Details {
   }
 #endif
 
+  void BodyStreamToFile(
+      Azure::Core::Http::BodyStream& stream,
+      FileWriter& fileWriter,
+      int64_t offset,
+      int64_t length,
+      const Azure::Core::Context& context)
+  {
+    constexpr int64_t BufferSize = 4 * 1024 * 1024;
+
+    // One buffer is filled from the stream while the other one is being written to the file.
+    std::vector<uint8_t> buffers[2];
+    std::unique_ptr<TransferTask> pendingWrite;
+    int current = 0;
+    while (length > 0)
+    {
+      auto& buffer = buffers[current];
+      int64_t readSize = std::min(BufferSize, length);
+      buffer.resize(static_cast<std::size_t>(readSize));
+      int64_t bytesRead
+          = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.data(), readSize);
+      if (bytesRead != readSize)
+      {
+        throw Azure::Core::RequestFailedException("error when reading body stream");
+      }
+      if (pendingWrite)
+      {
+        pendingWrite->Wait();
+        pendingWrite.reset();
+      }
+      length -= bytesRead;
+      if (length == 0)
+      {
+        // Nothing left to read, no need to hand the last buffer off to another thread.
+        fileWriter.Write(buffer.data(), bytesRead, offset);
+        break;
+      }
+      pendingWrite = std::make_unique<TransferTask>([&fileWriter, &buffer, bytesRead, offset]() {
+        fileWriter.Write(buffer.data(), bytesRead, offset);
+      });
+      offset += bytesRead;
+      current = 1 - current;
+    }
+  }
+
 }}} // namespace Azure::Storage::Details
@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/read_ahead_stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  ReadAheadStream::ReadAheadStream(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int64_t windowSize,
+      ChunkFetcher fetcher,
+      const Azure::Core::Context& context)
+      : m_offset(offset), m_length(length), m_chunkSize(std::max(chunkSize, int64_t(1))),
+        m_windowChunks(static_cast<std::size_t>(std::max(windowSize / m_chunkSize, int64_t(1)))),
+        m_fetcher(std::move(fetcher)),
+        m_context(context.WithDeadline(Azure::Core::Context::time_point::max()))
+  {
+  }
+
+  ReadAheadStream::~ReadAheadStream()
+  {
+    // Fetches that haven't started yet are skipped, the ones in flight are aborted.
+    m_context.Cancel();
+    ClearWindow();
+  }
+
+  void ReadAheadStream::Rewind()
+  {
+    ClearWindow();
+    m_nextFetchOffset = 0;
+    m_chunkPosition = 0;
+  }
+
+  void ReadAheadStream::ClearWindow()
+  {
+    for (auto& chunk : m_window)
+    {
+      try
+      {
+        chunk.Task->Wait();
+      }
+      catch (...)
+      {
+      }
+    }
+    m_window.clear();
+  }
+
+  void ReadAheadStream::FillWindow()
+  {
+    while (m_window.size() < m_windowChunks && m_nextFetchOffset < m_length)
+    {
+      Chunk chunk;
+      chunk.Offset = m_nextFetchOffset;
+      chunk.Length = std::min(m_chunkSize, m_length - m_nextFetchOffset);
+      if (!m_freeBuffers.empty())
+      {
+        chunk.Buffer = std::move(m_freeBuffers.back());
+        m_freeBuffers.pop_back();
+      }
+      chunk.Buffer.resize(static_cast<std::size_t>(chunk.Length));
+
+      const int64_t fetchOffset = m_offset + chunk.Offset;
+      const int64_t fetchLength = chunk.Length;
+      // The buffer is owned by the chunk, which outlives the task.
+      uint8_t* fetchBuffer = chunk.Buffer.data();
+      chunk.Task = std::make_unique<TransferTask>([this, fetchOffset, fetchLength, fetchBuffer]() {
+        m_context.ThrowIfCancelled();
+        m_fetcher(fetchOffset, fetchLength, fetchBuffer, m_context);
+      });
+
+      m_nextFetchOffset += chunk.Length;
+      m_window.push_back(std::move(chunk));
+    }
+  }
+
+  int64_t ReadAheadStream::OnRead(
+      const Azure::Core::Context& context,
+      uint8_t* buffer,
+      int64_t count)
+  {
+    context.ThrowIfCancelled();
+
+    FillWindow();
+    if (m_window.empty() || count <= 0)
+    {
+      return 0;
+    }
+
+    auto& chunk = m_window.front();
+    chunk.Task->Wait();
+
+    const int64_t bytesRead = std::min(count, chunk.Length - m_chunkPosition);
+    std::memcpy(
+        buffer,
+        chunk.Buffer.data() + m_chunkPosition,
+        static_cast<std::size_t>(bytesRead));
+    m_chunkPosition += bytesRead;
+
+    if (m_chunkPosition == chunk.Length)
+    {
+      m_freeBuffers.push_back(std::move(chunk.Buffer));
+      m_window.pop_front();
+      m_chunkPosition = 0;
+      FillWindow();
+    }
+    return bytesRead;
+  }
+
+}}} // namespace Azure::Storage::Details
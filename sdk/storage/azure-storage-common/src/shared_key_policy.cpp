@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <vector>
 
 #include <azure/core/http/http.hpp>
 #include <azure/core/internal/strings.hpp>
@@ -13,76 +14,156 @@
 
 namespace Azure { namespace Storage { namespace Details {
 
-  std::string SharedKeyPolicy::GetSignature(const Core::Http::Request& request) const
-  {
-    std::string string_to_sign;
-    string_to_sign += Azure::Core::Http::HttpMethodToString(request.GetMethod()) + "\n";
-
-    const auto& headers = request.GetHeaders();
-    for (std::string headerName :
-         {"Content-Encoding",
-          "Content-Language",
-          "Content-Length",
-          "Content-MD5",
-          "Content-Type",
-          "Date",
-          "If-Modified-Since",
-          "If-Match",
-          "If-None-Match",
-          "If-Unmodified-Since",
-          "Range"})
+  namespace {
+    // Headers in the order they appear in the string-to-sign. Names are lower case, as
+    // Request::AddHeader stores them.
+    const std::string StandardHeaderNames[] = {
+        "content-encoding",
+        "content-language",
+        "content-length",
+        "content-md5",
+        "content-type",
+        "date",
+        "if-modified-since",
+        "if-match",
+        "if-none-match",
+        "if-unmodified-since",
+        "range",
+    };
+    constexpr std::size_t ContentLengthIndex = 2;
+    constexpr std::size_t NumStandardHeaders
+        = sizeof(StandardHeaderNames) / sizeof(StandardHeaderNames[0]);
+
+    const std::string XMsHeaderPrefix = "x-ms-";
+
+    bool IsXMsHeader(const std::string& name)
+    {
+      return name.compare(0, XMsHeaderPrefix.length(), XMsHeaderPrefix) == 0;
+    }
+
+    void AppendUrlDecoded(std::string& output, const std::string& value)
     {
-      auto ite = headers.find(Azure::Core::Internal::Strings::ToLower(headerName));
-      if (ite != headers.end())
+      if (value.find_first_of("%+") == std::string::npos)
       {
-        if (headerName == "Content-Length" && ite->second == "0")
-        {
-          // do nothing
-        }
-        else
-        {
-          string_to_sign += ite->second;
-        }
+        output += value;
+      }
+      else
+      {
+        output += Azure::Core::Http::Url::Decode(value);
       }
-      string_to_sign += "\n";
     }
 
-    // canonicalized headers
-    const std::string prefix = "x-ms-";
-    std::vector<std::pair<std::string, std::string>> ordered_kv;
-    for (auto ite = headers.lower_bound(prefix);
-         ite != headers.end() && ite->first.substr(0, prefix.length()) == prefix;
-         ++ite)
+    // A key that has no upper case letters and nothing to decode is its own canonical form, if all
+    // keys are like this the query parameters are already in canonical order.
+    bool IsCanonicalQueryKey(const std::string& key)
     {
-      std::string key = Azure::Core::Internal::Strings::ToLower(ite->first);
-      ordered_kv.emplace_back(std::make_pair(std::move(key), ite->second));
+      return std::none_of(key.begin(), key.end(), [](char c) {
+        return (c >= 'A' && c <= 'Z') || c == '%' || c == '+';
+      });
     }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
-    for (const auto& p : ordered_kv)
+  } // namespace
+
+  void BuildSharedKeyStringToSign(
+      const Core::Http::Request& request,
+      const std::string& accountName,
+      std::string& stringToSign)
+  {
+    stringToSign.clear();
+    stringToSign += Azure::Core::Http::HttpMethodToString(request.GetMethod());
+    stringToSign += '\n';
+
+    const std::string* standardHeaderValues[NumStandardHeaders] = {};
+    request.ForEachHeader(
+        [&standardHeaderValues](const std::string& name, const std::string& value) {
+          if (IsXMsHeader(name))
+          {
+            return;
+          }
+          for (std::size_t i = 0; i < NumStandardHeaders; ++i)
+          {
+            if (name == StandardHeaderNames[i])
+            {
+              standardHeaderValues[i] = &value;
+              break;
+            }
+          }
+        });
+    for (std::size_t i = 0; i < NumStandardHeaders; ++i)
     {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      const std::string* value = standardHeaderValues[i];
+      if (value != nullptr && !(i == ContentLengthIndex && *value == "0"))
+      {
+        stringToSign += *value;
+      }
+      stringToSign += '\n';
     }
-    ordered_kv.clear();
+
+    // canonicalized headers, already sorted and in lower case
+    request.ForEachHeader([&stringToSign](const std::string& name, const std::string& value) {
+      if (IsXMsHeader(name))
+      {
+        stringToSign += name;
+        stringToSign += ':';
+        stringToSign += value;
+        stringToSign += '\n';
+      }
+    });
 
     // canonicalized resource
-    string_to_sign += "/" + m_credential->AccountName + "/" + request.GetUrl().GetPath() + "\n";
-    for (const auto& query : request.GetUrl().GetQueryParameters())
+    stringToSign += '/';
+    stringToSign += accountName;
+    stringToSign += '/';
+    stringToSign += request.GetUrl().GetPath();
+    stringToSign += '\n';
+    const auto& queryParameters = request.GetUrl().GetQueryParameters();
+    if (std::all_of(
+            queryParameters.begin(),
+            queryParameters.end(),
+            [](const std::pair<const std::string, std::string>& query) {
+              return IsCanonicalQueryKey(query.first);
+            }))
     {
-      std::string key = Azure::Core::Internal::Strings::ToLower(query.first);
-      ordered_kv.emplace_back(std::make_pair(
-          Azure::Core::Http::Url::Decode(key), Azure::Core::Http::Url::Decode(query.second)));
+      for (const auto& query : queryParameters)
+      {
+        stringToSign += query.first;
+        stringToSign += ':';
+        AppendUrlDecoded(stringToSign, query.second);
+        stringToSign += '\n';
+      }
     }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
-    for (const auto& p : ordered_kv)
+    else
     {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      std::vector<std::pair<std::string, std::string>> orderedQueryParameters;
+      for (const auto& query : queryParameters)
+      {
+        orderedQueryParameters.emplace_back(
+            Azure::Core::Http::Url::Decode(
+                Azure::Core::Internal::Strings::ToLower(query.first)),
+            Azure::Core::Http::Url::Decode(query.second));
+      }
+      std::sort(orderedQueryParameters.begin(), orderedQueryParameters.end());
+      for (const auto& query : orderedQueryParameters)
+      {
+        stringToSign += query.first;
+        stringToSign += ':';
+        stringToSign += query.second;
+        stringToSign += '\n';
+      }
     }
 
     // remove last linebreak
-    string_to_sign.pop_back();
+    stringToSign.pop_back();
+  }
+
+  std::string SharedKeyPolicy::GetSignature(const Core::Http::Request& request) const
+  {
+    // Reused across requests on the same thread to keep its capacity.
+    static thread_local std::string stringToSign;
+    BuildSharedKeyStringToSign(request, m_credential->AccountName, stringToSign);
 
-    return Azure::Core::Base64Encode(Details::HmacSha256(
-        std::vector<uint8_t>(string_to_sign.begin(), string_to_sign.end()),
-        Azure::Core::Base64Decode(m_credential->GetAccountKey())));
+    uint8_t signature[HmacSha256Context::HashLength];
+    m_credential->GetSigningContext()->Sign(
+        reinterpret_cast<const uint8_t*>(stringToSign.data()), stringToSign.length(), signature);
+    return Azure::Core::Base64Encode(signature, sizeof(signature));
   }
 }}} // namespace Azure::Storage::Details
@@ -5,6 +5,26 @@
 
 #include <algorithm>
 
+#include <azure/core/base64.hpp>
+
+#include "azure/storage/common/crypt.hpp"
+
+namespace Azure { namespace Storage {
+
+  std::shared_ptr<const Details::HmacSha256Context>
+  StorageSharedKeyCredential::GetSigningContext() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_signingContext)
+    {
+      m_signingContext
+          = std::make_shared<Details::HmacSha256Context>(Azure::Core::Base64Decode(m_accountKey));
+    }
+    return m_signingContext;
+  }
+
+}} // namespace Azure::Storage
+
 namespace Azure { namespace Storage { namespace Details {
 
   ConnectionStringParts ParseConnectionString(const std::string& connectionString)
@@ -4,6 +4,7 @@
 #include "azure/storage/common/storage_per_retry_policy.hpp"
 
 #include <azure/core/datetime.hpp>
+#include <azure/core/internal/date_time.hpp>
 #include <azure/core/platform.hpp>
 
 #include <chrono>
@@ -24,8 +25,7 @@ namespace Azure { namespace Storage { namespace Details {
       // add x-ms-date header in RFC1123 format
       request.AddHeader(
           HttpHeaderXMsDate,
-          Core::DateTime(std::chrono::system_clock::now())
-              .ToString(Azure::Core::DateTime::DateFormat::Rfc1123));
+          Core::Internal::ToRfc1123String(Core::DateTime(std::chrono::system_clock::now())));
     }
 
     return nextHttpPolicy.Send(ctx, request);
@@ -3,6 +3,7 @@
 
 #include "azure/storage/common/storage_retry_policy.hpp"
 
+#include <random>
 #include <thread>
 
 #include "azure/storage/common/constants.hpp"
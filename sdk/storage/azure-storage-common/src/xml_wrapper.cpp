@@ -3,171 +3,607 @@
 
 #include "azure/storage/common/xml_wrapper.hpp"
 
-#include <limits>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
-#include <libxml/xmlreader.h>
-#include <libxml/xmlwriter.h>
-
 namespace Azure { namespace Storage { namespace Details {
 
-  struct XmlGlobalInitializer
-  {
-    XmlGlobalInitializer() { xmlInitParser(); }
-    ~XmlGlobalInitializer() { xmlCleanupParser(); }
-  };
+  namespace {
+    constexpr std::size_t StreamChunkSize = 64 * 1024;
 
-  static void XmlGlobalInitialize() { static XmlGlobalInitializer globalInitializer; }
+    [[noreturn]] void ThrowParseError() { throw std::runtime_error("failed to parse xml"); }
 
-  XmlReader::XmlReader(const char* data, std::size_t length)
-  {
-    XmlGlobalInitialize();
+    bool IsWhitespace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
 
-    if (length > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+    bool IsNameEnd(char c)
     {
-      throw std::runtime_error("xml data too big");
+      return IsWhitespace(c) || c == '>' || c == '/' || c == '=' || c == '\0';
     }
 
-    m_reader = xmlReaderForMemory(data, static_cast<int>(length), nullptr, nullptr, 0);
-    if (!m_reader)
+    char* EncodeUtf8(uint32_t codePoint, char* out)
     {
-      throw std::runtime_error("failed to parse xml");
+      if (codePoint < 0x80)
+      {
+        *out++ = static_cast<char>(codePoint);
+      }
+      else if (codePoint < 0x800)
+      {
+        *out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      else if (codePoint < 0x10000)
+      {
+        *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      else
+      {
+        *out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      return out;
     }
-  }
 
-  XmlReader::~XmlReader() { xmlFreeTextReader(static_cast<xmlTextReaderPtr>(m_reader)); }
-
-  XmlNode XmlReader::Read()
-  {
-    xmlTextReaderPtr reader = static_cast<xmlTextReaderPtr>(m_reader);
-    if (m_readingAttributes)
+    // Decodes a character or entity reference, "&...;", returns the end of the decoded output.
+    char* DecodeReference(const char* begin, const char* end, char* out)
     {
-      int ret = xmlTextReaderMoveToNextAttribute(reader);
-      if (ret == 1)
+      const std::size_t length = static_cast<std::size_t>(end - begin);
+      auto is = [begin, length](const char* name) {
+        return std::strlen(name) == length && std::memcmp(begin, name, length) == 0;
+      };
+      if (is("lt"))
       {
-        const char* name = reinterpret_cast<const char*>(xmlTextReaderName(reader));
-        const char* value = reinterpret_cast<const char*>(xmlTextReaderValue(reader));
-        return XmlNode{XmlNodeType::Attribute, name, value};
+        *out++ = '<';
+      }
+      else if (is("gt"))
+      {
+        *out++ = '>';
+      }
+      else if (is("amp"))
+      {
+        *out++ = '&';
+      }
+      else if (is("quot"))
+      {
+        *out++ = '"';
+      }
+      else if (is("apos"))
+      {
+        *out++ = '\'';
       }
-      else if (ret == 0)
+      else if (length >= 2 && begin[0] == '#')
       {
-        m_readingAttributes = false;
+        const bool hex = begin[1] == 'x';
+        const char* digit = begin + (hex ? 2 : 1);
+        if (digit == end || end - digit > 8)
+        {
+          ThrowParseError();
+        }
+        uint32_t codePoint = 0;
+        for (; digit != end; ++digit)
+        {
+          const char c = *digit;
+          uint32_t value;
+          if (c >= '0' && c <= '9')
+          {
+            value = static_cast<uint32_t>(c - '0');
+          }
+          else if (hex && c >= 'a' && c <= 'f')
+          {
+            value = static_cast<uint32_t>(c - 'a' + 10);
+          }
+          else if (hex && c >= 'A' && c <= 'F')
+          {
+            value = static_cast<uint32_t>(c - 'A' + 10);
+          }
+          else
+          {
+            ThrowParseError();
+          }
+          codePoint = codePoint * (hex ? 16 : 10) + value;
+        }
+        if (codePoint == 0 || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        {
+          ThrowParseError();
+        }
+        out = EncodeUtf8(codePoint, out);
       }
       else
       {
-        throw std::runtime_error("failed to parse xml");
+        ThrowParseError();
       }
+      return out;
     }
 
-    int ret = xmlTextReaderRead(reader);
-    if (ret == 0)
+    // Decodes references and normalizes whitespace in [begin, end) in place and terminates the
+    // result. Whatever is decoded is never longer than its source.
+    void DecodeAndTerminate(char* begin, char* end, bool attributeValue)
     {
-      return XmlNode{XmlNodeType::End};
+      auto needsDecoding = [attributeValue](char c) {
+        return c == '&' || c == '\r' || (attributeValue && (c == '\n' || c == '\t'));
+      };
+      char* in = std::find_if(begin, end, needsDecoding);
+      char* out = in;
+      while (in != end)
+      {
+        const char c = *in;
+        if (c == '&')
+        {
+          char* semicolon = std::find(in + 1, end, ';');
+          if (semicolon == end)
+          {
+            ThrowParseError();
+          }
+          out = DecodeReference(in + 1, semicolon, out);
+          in = semicolon + 1;
+        }
+        else if (c == '\r')
+        {
+          // "\r\n" and lone '\r' are line breaks
+          *out++ = attributeValue ? ' ' : '\n';
+          ++in;
+          if (in != end && *in == '\n')
+          {
+            ++in;
+          }
+        }
+        else
+        {
+          *out++ = (attributeValue && (c == '\n' || c == '\t')) ? ' ' : c;
+          ++in;
+        }
+      }
+      *out = '\0';
+    }
+  } // namespace
+
+  XmlReader::XmlReader(const char* data, std::size_t length) : m_buffer(data, length)
+  {
+    // UTF-8 byte order mark
+    if (m_buffer.compare(0, 3, "\xEF\xBB\xBF") == 0)
+    {
+      m_cursor = 3;
     }
-    if (ret != 1)
+    m_openTagOffsets.reserve(16);
+  }
+
+  XmlReader::XmlReader(Azure::Core::Http::BodyStream& stream, const Azure::Core::Context& context)
+      : m_stream(&stream), m_context(context), m_streamBuffer(StreamChunkSize)
+  {
+    while (m_buffer.size() < 3 && ReadFromStream())
     {
-      throw std::runtime_error("failed to parse xml");
     }
+    if (m_buffer.compare(0, 3, "\xEF\xBB\xBF") == 0)
+    {
+      m_cursor = 3;
+    }
+    m_openTagOffsets.reserve(16);
+  }
 
-    int type = xmlTextReaderNodeType(reader);
-    bool is_empty = xmlTextReaderIsEmptyElement(reader) == 1;
-    bool has_value = xmlTextReaderHasValue(reader) == 1;
-    bool has_attributes = xmlTextReaderHasAttributes(reader) == 1;
+  XmlReader::~XmlReader() {}
 
-    const char* name = reinterpret_cast<const char*>(xmlTextReaderName(reader));
-    const char* value = reinterpret_cast<const char*>(xmlTextReaderValue(reader));
+  bool XmlReader::ReadFromStream()
+  {
+    // what has been parsed is no longer referenced
+    m_buffer.erase(0, m_cursor);
+    m_cursor = 0;
 
-    if (has_attributes)
+    const auto bytesRead = m_stream->Read(
+        m_context, m_streamBuffer.data(), static_cast<int64_t>(m_streamBuffer.size()));
+    m_buffer.append(
+        reinterpret_cast<const char*>(m_streamBuffer.data()), static_cast<std::size_t>(bytesRead));
+    if (bytesRead == 0)
     {
-      m_readingAttributes = true;
+      m_stream = nullptr;
     }
+    return bytesRead != 0;
+  }
 
-    if (type == XML_READER_TYPE_ELEMENT && is_empty)
+  // Whether the text or markup at the cursor is complete in the buffer, so that it can be parsed
+  // without looking past the end of what has been read from the stream.
+  bool XmlReader::HasCompleteToken() const
+  {
+    const char* p = m_buffer.data() + m_cursor;
+    const char* const end = m_buffer.data() + m_buffer.size();
+    if (p == end)
     {
-      return XmlNode{XmlNodeType::SelfClosingTag, name};
+      return false;
     }
-    else if (type == XML_READER_TYPE_ELEMENT)
+    if (!m_atTag && *p != '<')
     {
-      return XmlNode{XmlNodeType::StartTag, name};
+      // the character after the '<' that ends the text decides whether whitespace is kept
+      const char* lt
+          = static_cast<const char*>(std::memchr(p, '<', static_cast<std::size_t>(end - p)));
+      return lt != nullptr && end - lt > 1;
     }
-    else if (type == XML_READER_TYPE_END_ELEMENT)
+    // long enough to tell "<![CDATA[" from the other kinds of markup
+    if (end - p < 9)
     {
-      return XmlNode{XmlNodeType::EndTag, name};
+      return false;
     }
-    else if (type == XML_READER_TYPE_TEXT)
+    const char* q = p + 1;
+    auto contains = [end](const char* first, const char* delimiter) {
+      return std::search(first, end, delimiter, delimiter + std::strlen(delimiter)) != end;
+    };
+    if (*q == '?')
     {
-      if (has_value)
+      return contains(q, "?>");
+    }
+    if (*q == '!')
+    {
+      if (std::strncmp(q, "!--", 3) == 0)
+      {
+        return contains(q + 3, "-->");
+      }
+      if (std::strncmp(q, "![CDATA[", 8) == 0)
       {
-        return XmlNode{XmlNodeType::Text, nullptr, value};
+        return contains(q + 8, "]]>");
       }
+      return true;
     }
-    else if (type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE)
+    for (; q != end; ++q)
     {
-      // silently ignore
+      if (*q == '"' || *q == '\'')
+      {
+        q = std::find(q + 1, end, *q);
+        if (q == end)
+        {
+          return false;
+        }
+      }
+      else if (*q == '>')
+      {
+        return true;
+      }
     }
-    else
+    return false;
+  }
+
+  XmlNode XmlReader::Read()
+  {
+    if (m_readingAttributes)
     {
-      throw std::runtime_error("unknown type " + std::to_string(type) + " while parsing xml");
+      char* const begin = &m_buffer[0];
+      char* p = begin + m_attributesCursor;
+      char* const attributesEnd = begin + m_attributesEnd;
+      while (p != attributesEnd && IsWhitespace(*p))
+      {
+        ++p;
+      }
+      if (p != attributesEnd)
+      {
+        char* name = p;
+        while (p != attributesEnd && !IsNameEnd(*p))
+        {
+          ++p;
+        }
+        char* nameEnd = p;
+        while (p != attributesEnd && IsWhitespace(*p))
+        {
+          ++p;
+        }
+        if (name == nameEnd || p == attributesEnd || *p != '=')
+        {
+          ThrowParseError();
+        }
+        ++p;
+        while (p != attributesEnd && IsWhitespace(*p))
+        {
+          ++p;
+        }
+        if (p == attributesEnd || (*p != '"' && *p != '\''))
+        {
+          ThrowParseError();
+        }
+        char* value = p + 1;
+        char* valueEnd = std::find(value, attributesEnd, *p);
+        if (valueEnd == attributesEnd)
+        {
+          ThrowParseError();
+        }
+        m_attributesCursor = static_cast<std::size_t>(valueEnd + 1 - begin);
+        *nameEnd = '\0';
+        DecodeAndTerminate(value, valueEnd, true);
+        return XmlNode{XmlNodeType::Attribute, name, value};
+      }
+      m_readingAttributes = false;
     }
 
-    return Read();
-  }
+    while (true)
+    {
+      if (m_stream != nullptr)
+      {
+        while (!HasCompleteToken() && ReadFromStream())
+        {
+        }
+      }
+      char* const begin = &m_buffer[0];
+      // std::string keeps a '\0' after the last character, which ends every scan below
+      char* const end = begin + m_buffer.size();
+      char* p = begin + m_cursor;
+      if (p >= end)
+      {
+        if (!m_rootSeen || !m_openTagOffsets.empty())
+        {
+          ThrowParseError();
+        }
+        return XmlNode{XmlNodeType::End};
+      }
 
-  XmlWriter::XmlWriter()
-  {
-    XmlGlobalInitialize();
-    m_buffer = xmlBufferCreate();
-    m_writer = xmlNewTextWriterMemory(static_cast<xmlBufferPtr>(m_buffer), 0);
-    xmlTextWriterStartDocument(static_cast<xmlTextWriterPtr>(m_writer), nullptr, nullptr, nullptr);
-  }
+      if (!m_atTag && *p != '<')
+      {
+        char* textEnd = static_cast<char*>(std::memchr(p, '<', static_cast<std::size_t>(end - p)));
+        if (textEnd == nullptr)
+        {
+          textEnd = end;
+        }
+        m_cursor = static_cast<std::size_t>(textEnd - begin);
+        m_atTag = textEnd != end;
 
-  XmlWriter::~XmlWriter()
-  {
-    xmlFreeTextWriter(static_cast<xmlTextWriterPtr>(m_writer));
-    xmlBufferFree(static_cast<xmlBufferPtr>(m_buffer));
+        const bool whitespaceOnly = std::all_of(p, textEnd, IsWhitespace);
+        if (m_openTagOffsets.empty())
+        {
+          if (!whitespaceOnly)
+          {
+            ThrowParseError();
+          }
+          continue;
+        }
+        // Whitespace between elements is formatting. The content of an element holding nothing
+        // else, as in "<Name> </Name>", is kept.
+        if (whitespaceOnly && !(m_lastWasStartTag && m_atTag && textEnd[1] == '/'))
+        {
+          continue;
+        }
+        DecodeAndTerminate(p, textEnd, false);
+        m_lastWasStartTag = false;
+        return XmlNode{XmlNodeType::Text, nullptr, p};
+      }
+
+      m_atTag = false;
+      char* q = p + 1;
+      if (*q == '/')
+      {
+        char* name = q + 1;
+        char* nameEnd = name;
+        while (!IsNameEnd(*nameEnd))
+        {
+          ++nameEnd;
+        }
+        char* gt = nameEnd;
+        while (IsWhitespace(*gt))
+        {
+          ++gt;
+        }
+        if (*gt != '>' || m_openTagOffsets.empty())
+        {
+          ThrowParseError();
+        }
+        *nameEnd = '\0';
+        if (std::strcmp(m_openTags.data() + m_openTagOffsets.back(), name) != 0)
+        {
+          ThrowParseError();
+        }
+        m_openTags.resize(m_openTagOffsets.back());
+        m_openTagOffsets.pop_back();
+        m_cursor = static_cast<std::size_t>(gt + 1 - begin);
+        m_lastWasStartTag = false;
+        return XmlNode{XmlNodeType::EndTag, name};
+      }
+      else if (*q == '?')
+      {
+        // XML declaration or processing instruction
+        const char* close = std::strstr(q, "?>");
+        if (close == nullptr)
+        {
+          ThrowParseError();
+        }
+        m_cursor = static_cast<std::size_t>(close + 2 - begin);
+        continue;
+      }
+      else if (*q == '!')
+      {
+        if (std::strncmp(q, "!--", 3) == 0)
+        {
+          const char* close = std::strstr(q + 3, "-->");
+          if (close == nullptr)
+          {
+            ThrowParseError();
+          }
+          m_cursor = static_cast<std::size_t>(close + 3 - begin);
+          continue;
+        }
+        if (std::strncmp(q, "![CDATA[", 8) == 0 && !m_openTagOffsets.empty())
+        {
+          char* text = q + 8;
+          char* close = std::strstr(text, "]]>");
+          if (close == nullptr)
+          {
+            ThrowParseError();
+          }
+          m_cursor = static_cast<std::size_t>(close + 3 - begin);
+          *close = '\0';
+          m_lastWasStartTag = false;
+          return XmlNode{XmlNodeType::Text, nullptr, text};
+        }
+        // document type declarations are not supported
+        ThrowParseError();
+      }
+
+      char* name = q;
+      char* nameEnd = name;
+      while (!IsNameEnd(*nameEnd))
+      {
+        ++nameEnd;
+      }
+      if (nameEnd == name || (m_rootSeen && m_openTagOffsets.empty()))
+      {
+        ThrowParseError();
+      }
+      // find the end of the tag, skipping over quoted attribute values
+      char* gt = nameEnd;
+      while (*gt != '>')
+      {
+        if (*gt == '"' || *gt == '\'')
+        {
+          gt = std::find(gt + 1, end, *gt);
+        }
+        if (gt == end)
+        {
+          ThrowParseError();
+        }
+        ++gt;
+      }
+      const bool selfClosing = gt[-1] == '/' && gt - 1 >= nameEnd;
+      char* attributesEnd = selfClosing ? gt - 1 : gt;
+      m_attributesCursor = static_cast<std::size_t>(std::min(nameEnd + 1, attributesEnd) - begin);
+      m_attributesEnd = static_cast<std::size_t>(attributesEnd - begin);
+      m_readingAttributes = m_attributesCursor < m_attributesEnd;
+      m_cursor = static_cast<std::size_t>(gt + 1 - begin);
+      *nameEnd = '\0';
+      m_rootSeen = true;
+      if (selfClosing)
+      {
+        m_lastWasStartTag = false;
+        return XmlNode{XmlNodeType::SelfClosingTag, name};
+      }
+      m_openTagOffsets.push_back(m_openTags.size());
+      m_openTags.append(name, nameEnd + 1);
+      m_lastWasStartTag = true;
+      return XmlNode{XmlNodeType::StartTag, name};
+    }
   }
 
   namespace {
-    inline xmlChar* BadCast(const char* x)
+    void AppendEscaped(std::string& out, const char* value, bool isAttribute)
     {
-      return const_cast<xmlChar*>(reinterpret_cast<const xmlChar*>(x));
+      // line breaks and tabs in attributes would be normalized to spaces by the reader
+      const char* specialCharacters = isAttribute ? "&<>\"\r\n\t" : "&<>\"\r";
+      while (true)
+      {
+        std::size_t length = std::strcspn(value, specialCharacters);
+        out.append(value, length);
+        value += length;
+        switch (*value)
+        {
+          case '\0':
+            return;
+          case '&':
+            out += "&amp;";
+            break;
+          case '<':
+            out += "&lt;";
+            break;
+          case '>':
+            out += "&gt;";
+            break;
+          case '"':
+            out += "&quot;";
+            break;
+          case '\r':
+            out += "&#13;";
+            break;
+          case '\n':
+            out += "&#10;";
+            break;
+          default:
+            out += "&#9;";
+            break;
+        }
+        ++value;
+      }
     }
   } // namespace
 
+  XmlWriter::XmlWriter() { m_document = "<?xml version=\"1.0\"?>\n"; }
+
+  XmlWriter::~XmlWriter() {}
+
+  void XmlWriter::CloseStartTag()
+  {
+    if (m_startTagOpen)
+    {
+      m_document += '>';
+      m_startTagOpen = false;
+    }
+  }
+
   void XmlWriter::Write(XmlNode node)
   {
-    xmlTextWriterPtr writer = static_cast<xmlTextWriterPtr>(m_writer);
     if (node.Type == XmlNodeType::StartTag)
     {
+      CloseStartTag();
+      m_document += '<';
+      m_document += node.Name;
       if (!node.Value)
       {
-        xmlTextWriterStartElement(writer, BadCast(node.Name));
+        m_openTagOffsets.push_back(m_openTags.length());
+        m_openTags.append(node.Name, std::strlen(node.Name) + 1);
+        m_startTagOpen = true;
       }
       else
       {
-        xmlTextWriterWriteElement(writer, BadCast(node.Name), BadCast(node.Value));
+        m_document += '>';
+        AppendEscaped(m_document, node.Value, false);
+        m_document += "</";
+        m_document += node.Name;
+        m_document += '>';
       }
     }
-    else if (node.Type == XmlNodeType::EndTag)
+    else if (node.Type == XmlNodeType::EndTag || node.Type == XmlNodeType::End)
     {
-      xmlTextWriterEndElement(writer);
+      do
+      {
+        if (m_openTagOffsets.empty())
+        {
+          break;
+        }
+        if (m_startTagOpen)
+        {
+          m_document += "/>";
+          m_startTagOpen = false;
+        }
+        else
+        {
+          m_document += "</";
+          m_document += m_openTags.data() + m_openTagOffsets.back();
+          m_document += '>';
+        }
+        m_openTags.resize(m_openTagOffsets.back());
+        m_openTagOffsets.pop_back();
+      } while (node.Type == XmlNodeType::End);
+      if (node.Type == XmlNodeType::End)
+      {
+        m_document += '\n';
+      }
     }
     else if (node.Type == XmlNodeType::SelfClosingTag)
     {
-      xmlTextWriterStartElement(writer, BadCast(node.Name));
-      xmlTextWriterEndElement(writer);
+      CloseStartTag();
+      m_document += '<';
+      m_document += node.Name;
+      m_document += "/>";
     }
     else if (node.Type == XmlNodeType::Text)
     {
-      xmlTextWriterWriteString(writer, BadCast(node.Value));
+      CloseStartTag();
+      AppendEscaped(m_document, node.Value, false);
     }
     else if (node.Type == XmlNodeType::Attribute)
     {
-      xmlTextWriterWriteAttribute(writer, BadCast(node.Name), BadCast(node.Value));
-    }
-    else if (node.Type == XmlNodeType::End)
-    {
-      xmlTextWriterEndDocument(writer);
+      if (!m_startTagOpen)
+      {
+        throw std::runtime_error("xml attribute isn't in a start tag");
+      }
+      m_document += ' ';
+      m_document += node.Name;
+      m_document += "=\"";
+      AppendEscaped(m_document, node.Value, true);
+      m_document += '"';
     }
     else
     {
@@ -179,10 +615,10 @@ namespace Azure { namespace Storage { namespace Details {
 
   std::string XmlWriter::GetDocument()
   {
-    xmlTextWriterPtr writer = static_cast<xmlTextWriterPtr>(m_writer);
-    xmlBufferPtr buffer = static_cast<xmlBufferPtr>(m_buffer);
-    xmlTextWriterFlush(writer);
-    return std::string(reinterpret_cast<const char*>(buffer->content), buffer->use);
+    CloseStartTag();
+    std::string document;
+    document.swap(m_document);
+    return document;
   }
 
 }}} // namespace Azure::Storage::Details
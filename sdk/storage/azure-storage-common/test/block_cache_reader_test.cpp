@@ -0,0 +1,235 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <azure/storage/common/block_cache_reader.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    struct FakeResource
+    {
+      std::vector<uint8_t> Content;
+      std::mutex Mutex;
+      std::vector<std::pair<int64_t, int64_t>> Requests;
+
+      Details::BlockCacheReader::RangeFetcher GetFetcher()
+      {
+        return [this](
+                   int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context&) {
+          {
+            std::lock_guard<std::mutex> guard(Mutex);
+            Requests.emplace_back(offset, length);
+          }
+          std::memcpy(
+              buffer,
+              Content.data() + static_cast<std::size_t>(offset),
+              static_cast<std::size_t>(length));
+        };
+      }
+    };
+  } // namespace
+
+  TEST(BlockCacheReaderTest, ReadAt)
+  {
+    FakeResource resource;
+    resource.Content = RandomBuffer(static_cast<std::size_t>(100_KB + 1));
+    const int64_t size = static_cast<int64_t>(resource.Content.size());
+    auto reader = std::make_shared<Details::BlockCacheReader>(
+        size, 4_KB, 32_KB, 16_KB, 4, resource.GetFetcher());
+    EXPECT_EQ(reader->GetSize(), size);
+
+    std::mt19937_64 randomGenerator(std::random_device{}());
+    std::uniform_int_distribution<int64_t> offsetDistribution(0, size + 10);
+    std::uniform_int_distribution<int64_t> countDistribution(0, 40_KB);
+    for (int i = 0; i < 200; ++i)
+    {
+      const int64_t offset = offsetDistribution(randomGenerator);
+      const int64_t count = countDistribution(randomGenerator);
+      std::vector<uint8_t> buffer(static_cast<std::size_t>(count));
+      const int64_t bytesRead
+          = reader->ReadAt(offset, buffer.data(), count, Azure::Core::Context());
+      const int64_t expectedBytesRead = std::max(std::min(count, size - offset), int64_t(0));
+      ASSERT_EQ(bytesRead, expectedBytesRead);
+      EXPECT_TRUE(std::equal(
+          buffer.begin(),
+          buffer.begin() + bytesRead,
+          resource.Content.begin() + std::min(offset, size)));
+    }
+    for (const auto& request : resource.Requests)
+    {
+      EXPECT_EQ(request.first % static_cast<int64_t>(4_KB), 0);
+      EXPECT_LE(request.second, static_cast<int64_t>(16_KB));
+    }
+  }
+
+  TEST(BlockCacheReaderTest, CoalesceAndCache)
+  {
+    FakeResource resource;
+    resource.Content = RandomBuffer(static_cast<std::size_t>(64_KB));
+    auto reader = std::make_shared<Details::BlockCacheReader>(
+        64_KB, 4_KB, 64_KB, 64_KB, 4, resource.GetFetcher());
+
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(64_KB));
+    // one request for the blocks around it
+    reader->ReadAt(1_KB, buffer.data(), 10_KB, Azure::Core::Context());
+    ASSERT_EQ(resource.Requests.size(), 1U);
+    EXPECT_EQ(resource.Requests[0], std::make_pair(int64_t(0), int64_t(12_KB)));
+
+    // served from the cache
+    reader->ReadAt(2_KB, buffer.data(), 5_KB, Azure::Core::Context());
+    EXPECT_EQ(resource.Requests.size(), 1U);
+
+    // only the missing tail is downloaded
+    reader->ReadAt(8_KB, buffer.data(), 8_KB, Azure::Core::Context());
+    ASSERT_EQ(resource.Requests.size(), 2U);
+    EXPECT_EQ(resource.Requests[1], std::make_pair(int64_t(12_KB), int64_t(4_KB)));
+    EXPECT_TRUE(
+        std::equal(buffer.begin(), buffer.begin() + 8_KB, resource.Content.begin() + 8_KB));
+
+    // nearby ranges are prefetched with one request
+    reader->Prefetch({{33_KB, 100}, {37_KB, 100}, {42_KB, 3_KB}});
+    for (int i = 0; i < 1000; ++i)
+    {
+      {
+        std::lock_guard<std::mutex> guard(resource.Mutex);
+        if (resource.Requests.size() == 3)
+        {
+          break;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    reader->ReadAt(32_KB, buffer.data(), 16_KB, Azure::Core::Context());
+    ASSERT_EQ(resource.Requests.size(), 3U);
+    EXPECT_EQ(resource.Requests[2], std::make_pair(int64_t(32_KB), int64_t(16_KB)));
+    EXPECT_TRUE(
+        std::equal(buffer.begin(), buffer.begin() + 16_KB, resource.Content.begin() + 32_KB));
+  }
+
+  TEST(BlockCacheReaderTest, Eviction)
+  {
+    FakeResource resource;
+    resource.Content = RandomBuffer(static_cast<std::size_t>(64_KB));
+    auto reader = std::make_shared<Details::BlockCacheReader>(
+        64_KB, 4_KB, 8_KB, 4_KB, 1, resource.GetFetcher());
+
+    uint8_t byte;
+    reader->ReadAt(0, &byte, 1, Azure::Core::Context());
+    reader->ReadAt(4_KB, &byte, 1, Azure::Core::Context());
+    reader->ReadAt(0, &byte, 1, Azure::Core::Context());
+    EXPECT_EQ(resource.Requests.size(), 2U);
+    // evicts the least recently used block, which is the second one
+    reader->ReadAt(8_KB, &byte, 1, Azure::Core::Context());
+    reader->ReadAt(0, &byte, 1, Azure::Core::Context());
+    EXPECT_EQ(resource.Requests.size(), 3U);
+    reader->ReadAt(4_KB, &byte, 1, Azure::Core::Context());
+    EXPECT_EQ(resource.Requests.size(), 4U);
+    EXPECT_EQ(byte, resource.Content[static_cast<std::size_t>(4_KB)]);
+  }
+
+  TEST(BlockCacheReaderTest, FetchError)
+  {
+    FakeResource resource;
+    resource.Content = RandomBuffer(static_cast<std::size_t>(64_KB));
+    std::atomic<bool> fail{true};
+    auto fetcher = resource.GetFetcher();
+    auto reader = std::make_shared<Details::BlockCacheReader>(
+        64_KB,
+        4_KB,
+        64_KB,
+        4_KB,
+        4,
+        [&](int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context& context) {
+          if (fail && offset == 8_KB)
+          {
+            throw std::runtime_error("fetch failed");
+          }
+          fetcher(offset, length, buffer, context);
+        });
+
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(64_KB));
+    EXPECT_THROW(
+        reader->ReadAt(0, buffer.data(), 64_KB, Azure::Core::Context()), std::runtime_error);
+    // failed blocks are downloaded again by the next read
+    fail = false;
+    EXPECT_EQ(
+        reader->ReadAt(0, buffer.data(), 64_KB, Azure::Core::Context()),
+        static_cast<int64_t>(64_KB));
+    EXPECT_EQ(buffer, resource.Content);
+  }
+
+  TEST(BlockCacheReaderTest, WaitForPrefetch)
+  {
+    FakeResource resource;
+    resource.Content = RandomBuffer(static_cast<std::size_t>(16_KB));
+    std::atomic<bool> prefetchStarted{false};
+    std::atomic<bool> releasePrefetch{false};
+    std::atomic<bool> failNext{true};
+    auto fetcher = resource.GetFetcher();
+    auto reader = std::make_shared<Details::BlockCacheReader>(
+        16_KB,
+        4_KB,
+        16_KB,
+        4_KB,
+        4,
+        [&](int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context& context) {
+          if (failNext.exchange(false))
+          {
+            prefetchStarted = true;
+            while (!releasePrefetch)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            throw std::runtime_error("prefetch failed");
+          }
+          fetcher(offset, length, buffer, context);
+        });
+
+    reader->Prefetch({{0, 4_KB}});
+    while (!prefetchStarted)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // a read waiting for the prefetch can still be cancelled
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(4_KB));
+    auto cancelledContext = Azure::Core::Context().WithDeadline(
+        Azure::Core::Context::time_point::max());
+    cancelledContext.Cancel();
+    EXPECT_THROW(
+        reader->ReadAt(0, buffer.data(), 4_KB, cancelledContext),
+        Azure::Core::OperationCancelledException);
+
+    // and one whose prefetch fails fetches the block itself
+    int64_t bytesRead = 0;
+    std::thread readThread([&]() {
+      try
+      {
+        bytesRead = reader->ReadAt(0, buffer.data(), 4_KB, Azure::Core::Context());
+      }
+      catch (std::exception&)
+      {
+        bytesRead = -1;
+      }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    releasePrefetch = true;
+    readThread.join();
+    EXPECT_EQ(bytesRead, static_cast<int64_t>(4_KB));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), resource.Content.begin()));
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,234 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <azure/storage/common/concurrent_transfer.hpp>
+#include <azure/storage/common/file_io.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(ConcurrentTransferTest, AllChunksTransferred)
+  {
+    for (int concurrency : {1, 2, 5, 64})
+    {
+      const int64_t offset = 7;
+      const int64_t length = 1000;
+      const int64_t chunkSize = 33;
+      std::vector<std::atomic<int>> visited(static_cast<std::size_t>(length));
+      for (auto& v : visited)
+      {
+        v = 0;
+      }
+      std::atomic<int64_t> numChunksSeen{0};
+      Details::ConcurrentTransfer(
+          offset,
+          length,
+          chunkSize,
+          concurrency,
+          [&](int64_t chunkOffset, int64_t chunkLength, int64_t, int64_t numChunks) {
+            numChunksSeen = numChunks;
+            for (int64_t i = chunkOffset; i < chunkOffset + chunkLength; ++i)
+            {
+              visited[static_cast<std::size_t>(i - offset)].fetch_add(1);
+            }
+          },
+          Azure::Core::Context());
+      EXPECT_EQ(numChunksSeen.load(), (length + chunkSize - 1) / chunkSize);
+      for (auto& v : visited)
+      {
+        EXPECT_EQ(v.load(), 1);
+      }
+    }
+
+    bool called = false;
+    Details::ConcurrentTransfer(
+        0,
+        0,
+        4,
+        5,
+        [&](int64_t, int64_t, int64_t, int64_t) { called = true; },
+        Azure::Core::Context());
+    EXPECT_FALSE(called);
+  }
+
+  TEST(ConcurrentTransferTest, FirstErrorPropagated)
+  {
+    std::atomic<int> numCalls{0};
+    EXPECT_THROW(
+        Details::ConcurrentTransfer(
+            0,
+            1000,
+            1,
+            8,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              ++numCalls;
+              if (chunkId == 3)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            },
+            Azure::Core::Context()),
+        std::runtime_error);
+    // Workers stop picking up new chunks after the failure.
+    EXPECT_LT(numCalls.load(), 1000);
+  }
+
+  TEST(ConcurrentTransferTest, Cancellation)
+  {
+    Azure::Core::Context context;
+    std::atomic<int> numCalls{0};
+    EXPECT_THROW(
+        Details::ConcurrentTransfer(
+            0,
+            1000,
+            1,
+            4,
+            [&](int64_t, int64_t, int64_t, int64_t) {
+              if (++numCalls == 10)
+              {
+                context.Cancel();
+              }
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            },
+            context),
+        Azure::Core::OperationCancelledException);
+    EXPECT_LT(numCalls.load(), 1000);
+  }
+
+  TEST(ConcurrentTransferTest, ExecutorRunsAllTasks)
+  {
+    std::atomic<int> counter{0};
+    {
+      Details::TransferExecutor executor(4);
+      EXPECT_EQ(executor.GetMaxThreads(), 4U);
+      for (int i = 0; i < 1000; ++i)
+      {
+        executor.Submit([&executor, &counter]() {
+          ++counter;
+          // tasks queued from a worker end up on its own queue and get stolen by the others
+          executor.Submit([&counter]() { ++counter; });
+        });
+      }
+    }
+    EXPECT_EQ(counter.load(), 2000);
+  }
+
+  TEST(ConcurrentTransferTest, TransferTask)
+  {
+    std::atomic<int> counter{0};
+    {
+      Details::TransferTask task([&counter]() { ++counter; });
+      task.Wait();
+      EXPECT_EQ(counter.load(), 1);
+    }
+    {
+      Details::TransferTask task([]() { throw std::runtime_error("task failed"); });
+      EXPECT_THROW(task.Wait(), std::runtime_error);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, TreeWalk)
+  {
+    for (int concurrency : {1, 4, 16})
+    {
+      // every directory above depth 4 has three subdirectories
+      std::mutex mutex;
+      std::multiset<std::string> walked;
+      std::atomic<int> maxDepth{0};
+      Details::ConcurrentTreeWalk(
+          "root",
+          concurrency,
+          [&](const std::string& path,
+              int depth,
+              std::vector<std::string>& subdirectories,
+              const Azure::Core::Context&) {
+            {
+              std::lock_guard<std::mutex> guard(mutex);
+              walked.insert(path);
+              maxDepth = std::max(maxDepth.load(), depth);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (depth < 4)
+            {
+              for (int i = 0; i < 3; ++i)
+              {
+                subdirectories.push_back(path + "/" + std::to_string(i));
+              }
+            }
+          },
+          Azure::Core::Context());
+      EXPECT_EQ(walked.size(), 1U + 3U + 9U + 27U + 81U);
+      EXPECT_EQ(std::set<std::string>(walked.begin(), walked.end()).size(), walked.size());
+      EXPECT_EQ(walked.count("root/2/0/1/2"), 1U);
+      EXPECT_EQ(maxDepth.load(), 4);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, TreeWalkError)
+  {
+    std::atomic<int> numWalked{0};
+    std::atomic<int> numCancelled{0};
+    EXPECT_THROW(
+        Details::ConcurrentTreeWalk(
+            std::string(),
+            4,
+            [&](const std::string& path,
+                int depth,
+                std::vector<std::string>& subdirectories,
+                const Azure::Core::Context& context) {
+              ++numWalked;
+              if (path == "/99")
+              {
+                throw std::runtime_error("directory failed");
+              }
+              if (depth == 1)
+              {
+                // the last one is walked first, its failure cancels the others being walked
+                while (!context.IsCancelled())
+                {
+                  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                ++numCancelled;
+                context.ThrowIfCancelled();
+              }
+              for (int i = 0; i < 100; ++i)
+              {
+                subdirectories.push_back(path + "/" + std::to_string(i));
+              }
+            },
+            Azure::Core::Context()),
+        std::runtime_error);
+    EXPECT_LT(numWalked.load(), 101);
+    EXPECT_EQ(numCancelled.load(), numWalked.load() - 2);
+  }
+
+  TEST(ConcurrentTransferTest, BodyStreamToFile)
+  {
+    const std::string tempFilename = RandomString();
+    for (std::size_t size : {0_KB, 1_KB, 4_MB, 4_MB + 1, 13_MB + 7})
+    {
+      auto content = RandomBuffer(size);
+      {
+        Azure::Core::Http::MemoryBodyStream stream(content);
+        Details::FileWriter fileWriter(tempFilename);
+        Details::BodyStreamToFile(
+            stream, fileWriter, 0, static_cast<int64_t>(size), Azure::Core::Context());
+      }
+      EXPECT_EQ(ReadFile(tempFilename), content);
+    }
+    DeleteFile(tempFilename);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -37,6 +37,30 @@ namespace Azure { namespace Storage { namespace Test {
         "+SBESxQVhI53mSEdZJcCBpdBkaqwzfPaVYZMAf5LP3c=");
   }
 
+  TEST(CryptFunctionsTest, HmacSha256Context)
+  {
+    // a typical account key, one as long as the block size and one that is hashed first
+    for (std::size_t keyLength : {32, 64, 100})
+    {
+      std::vector<uint8_t> key(keyLength);
+      for (std::size_t i = 0; i < key.size(); ++i)
+      {
+        key[i] = static_cast<uint8_t>(i * 7 + 1);
+      }
+      Details::HmacSha256Context context(key);
+      for (const char* text : {"", "Hello Azure!"})
+      {
+        auto data = ToBinaryVector(text);
+        std::vector<uint8_t> hash(Details::HmacSha256Context::HashLength);
+        context.Sign(data.data(), data.size(), hash.data());
+        EXPECT_EQ(hash, Details::HmacSha256(data, key));
+        // the context can be reused
+        context.Sign(data.data(), data.size(), hash.data());
+        EXPECT_EQ(hash, Details::HmacSha256(data, key));
+      }
+    }
+  }
+
   static std::vector<uint8_t> ComputeHash(const std::string& data)
   {
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
@@ -120,6 +144,68 @@ namespace Azure { namespace Storage { namespace Test {
         crc64Single.Final(reinterpret_cast<const uint8_t*>(allData.data()), allData.size()));
   }
 
+  TEST(CryptFunctionsTest, Crc64Hash_Reference)
+  {
+    // bit by bit, to check whichever implementation the CPU gets against
+    auto reference = [](const uint8_t* data, std::size_t length) {
+      uint64_t crc = ~0ULL;
+      for (std::size_t i = 0; i < length; ++i)
+      {
+        crc ^= data[i];
+        for (int j = 0; j < 8; ++j)
+        {
+          crc = (crc >> 1) ^ ((crc & 1) ? 0x9A6C9329AC4BC9B5ULL : 0);
+        }
+      }
+      crc = ~crc;
+      std::vector<uint8_t> binary(sizeof(crc));
+      for (std::size_t i = 0; i < sizeof(crc); ++i)
+      {
+        binary[i] = static_cast<uint8_t>(crc >> (8 * i));
+      }
+      return binary;
+    };
+
+    auto data = RandomBuffer(static_cast<std::size_t>(1_MB + 64));
+    // unaligned starts, lengths around the 16 and 64 byte folding boundaries
+    for (std::size_t offset = 0; offset < 8; ++offset)
+    {
+      for (std::size_t length = 0; length < 300; ++length)
+      {
+        Crc64Hash instance;
+        EXPECT_EQ(instance.Final(&data[offset], length), reference(&data[offset], length));
+      }
+    }
+    const std::size_t length = static_cast<std::size_t>(1_MB + 13);
+    Crc64Hash instance;
+    EXPECT_EQ(instance.Final(&data[3], length), reference(&data[3], length));
+  }
+
+  TEST(CryptFunctionsTest, Crc64Hash_ParallelAppend)
+  {
+    auto data = RandomBuffer(static_cast<std::size_t>(40_MB + 7));
+    Crc64Hash crc64Single;
+    auto expected = crc64Single.Final(data.data(), data.size());
+
+    for (int concurrency : {1, 2, 3, 8})
+    {
+      Crc64Hash crc64Parallel;
+      crc64Parallel.Append(data.data(), 5);
+      crc64Parallel.ParallelAppend(data.data() + 5, data.size() - 5, concurrency);
+      EXPECT_EQ(crc64Parallel.Final(), expected);
+    }
+
+    Crc64Hash crc64Small;
+    crc64Small.ParallelAppend(data.data(), static_cast<std::size_t>(1_KB), 4);
+    Crc64Hash crc64Expected;
+    EXPECT_EQ(crc64Small.Final(), crc64Expected.Final(data.data(), static_cast<std::size_t>(1_KB)));
+
+    Crc64Hash crc64Done;
+    crc64Done.Final();
+    EXPECT_THROW(crc64Done.ParallelAppend(data.data(), data.size(), 4), std::runtime_error);
+    EXPECT_THROW(crc64Done.ParallelAppend(nullptr, 1, 4), std::invalid_argument);
+  }
+
   TEST(CryptFunctionsTest, Crc64Hash_ExpectThrow)
   {
     std::string data = "";
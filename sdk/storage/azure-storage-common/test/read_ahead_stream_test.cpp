@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <azure/storage/common/read_ahead_stream.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    Details::ReadAheadStream::ChunkFetcher MakeFetcher(
+        const std::vector<uint8_t>& content,
+        std::atomic<int>& numFetches)
+    {
+      return [&content, &numFetches](
+                 int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context&) {
+        ++numFetches;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::memcpy(
+            buffer,
+            content.data() + static_cast<std::size_t>(offset),
+            static_cast<std::size_t>(length));
+      };
+    }
+  } // namespace
+
+  TEST(ReadAheadStreamTest, ReadInOrder)
+  {
+    const auto content = RandomBuffer(static_cast<std::size_t>(100_KB + 17));
+    std::mt19937_64 randomGenerator(std::random_device{}());
+    for (int64_t chunkSize : {1_KB, 3_KB + 5, 200_KB})
+    {
+      for (int64_t offset : {0, 7})
+      {
+        const int64_t length = static_cast<int64_t>(content.size()) - offset - 3;
+        std::atomic<int> numFetches{0};
+        Details::ReadAheadStream stream(
+            offset,
+            length,
+            chunkSize,
+            chunkSize * 4,
+            MakeFetcher(content, numFetches),
+            Azure::Core::Context());
+        EXPECT_EQ(stream.Length(), length);
+
+        std::vector<uint8_t> downloaded;
+        std::uniform_int_distribution<int64_t> readSizeDistribution(1, 5_KB);
+        while (true)
+        {
+          std::vector<uint8_t> buffer(
+              static_cast<std::size_t>(readSizeDistribution(randomGenerator)));
+          int64_t bytesRead = stream.Read(Azure::Core::Context(), buffer.data(), buffer.size());
+          if (bytesRead == 0)
+          {
+            break;
+          }
+          downloaded.insert(downloaded.end(), buffer.begin(), buffer.begin() + bytesRead);
+        }
+        EXPECT_EQ(
+            downloaded,
+            std::vector<uint8_t>(content.begin() + offset, content.begin() + offset + length));
+        EXPECT_EQ(numFetches.load(), (length + chunkSize - 1) / chunkSize);
+
+        stream.Rewind();
+        std::vector<uint8_t> buffer(static_cast<std::size_t>(length));
+        EXPECT_EQ(
+            Azure::Core::Http::BodyStream::ReadToCount(
+                Azure::Core::Context(), stream, buffer.data(), length),
+            length);
+        EXPECT_EQ(buffer, downloaded);
+      }
+    }
+  }
+
+  TEST(ReadAheadStreamTest, FetchError)
+  {
+    const auto content = RandomBuffer(static_cast<std::size_t>(10_KB));
+    Details::ReadAheadStream stream(
+        0,
+        static_cast<int64_t>(content.size()),
+        1_KB,
+        4_KB,
+        [&content](int64_t offset, int64_t length, uint8_t* buffer, const Azure::Core::Context&) {
+          if (offset == 5_KB)
+          {
+            throw std::runtime_error("fetch failed");
+          }
+          std::memcpy(
+              buffer,
+              content.data() + static_cast<std::size_t>(offset),
+              static_cast<std::size_t>(length));
+        },
+        Azure::Core::Context());
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(5_KB));
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, buffer.data(), buffer.size()),
+        static_cast<int64_t>(buffer.size()));
+    EXPECT_THROW(stream.Read(Azure::Core::Context(), buffer.data(), 1), std::runtime_error);
+  }
+
+  TEST(ReadAheadStreamTest, DestroyedWhileFetching)
+  {
+    const auto content = RandomBuffer(static_cast<std::size_t>(64_KB));
+    std::atomic<int> numFetches{0};
+    {
+      Details::ReadAheadStream stream(
+          0,
+          static_cast<int64_t>(content.size()),
+          1_KB,
+          16_KB,
+          MakeFetcher(content, numFetches),
+          Azure::Core::Context());
+      uint8_t byte;
+      EXPECT_EQ(stream.Read(Azure::Core::Context(), &byte, 1), 1);
+    }
+    // Nothing past the window was fetched.
+    EXPECT_LE(numFetches.load(), 16);
+  }
+
+}}} // namespace Azure::Storage::Test
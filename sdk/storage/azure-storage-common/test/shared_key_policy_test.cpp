@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <string>
+
+#include <azure/core/http/http.hpp>
+#include <azure/storage/common/shared_key_policy.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::string GetStringToSign(
+        const Core::Http::Request& request,
+        const std::string& accountName = "account")
+    {
+      std::string stringToSign = "left over from a previous request";
+      Details::BuildSharedKeyStringToSign(request, accountName, stringToSign);
+      return stringToSign;
+    }
+  } // namespace
+
+  TEST(SharedKeyPolicyTest, StringToSignGetBlob)
+  {
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Get,
+        Core::Http::Url("https://account.blob.core.windows.net/container/dir/blob.txt"));
+    request.AddHeader("x-ms-version", "2020-02-10");
+    request.AddHeader("x-ms-date", "Thu, 18 Feb 2021 08:00:00 GMT");
+    request.AddHeader("x-ms-client-request-id", "0f6b2a3c-1c7e-4c1e-9d6b-3b6f6a9e2b10");
+    request.AddHeader("x-ms-range", "bytes=0-1023");
+    request.AddHeader("User-Agent", "azsdk-cpp-storage-blobs/12.0.0");
+    EXPECT_EQ(
+        GetStringToSign(request),
+        "GET\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "x-ms-client-request-id:0f6b2a3c-1c7e-4c1e-9d6b-3b6f6a9e2b10\n"
+        "x-ms-date:Thu, 18 Feb 2021 08:00:00 GMT\n"
+        "x-ms-range:bytes=0-1023\n"
+        "x-ms-version:2020-02-10\n"
+        "/account/container/dir/blob.txt");
+  }
+
+  TEST(SharedKeyPolicyTest, StringToSignStageBlock)
+  {
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Put,
+        Core::Http::Url("https://account.blob.core.windows.net/container/"
+                        "blob?comp=block&blockid=MDAw%2BMDAx%3D%3D"));
+    request.AddHeader("Content-Length", "4194304");
+    request.AddHeader("Content-MD5", "Q2hlY2sgSW50ZWdyaXR5IQ==");
+    request.AddHeader("Content-Type", "application/octet-stream");
+    request.AddHeader("x-ms-version", "2020-02-10");
+    request.AddHeader("x-ms-date", "Thu, 18 Feb 2021 08:00:00 GMT");
+    request.AddHeader("X-MS-Meta-Name", "value");
+    request.AddHeader("x-ms-lease-id", "lease");
+    EXPECT_EQ(
+        GetStringToSign(request),
+        "PUT\n"
+        "\n"
+        "\n"
+        "4194304\n"
+        "Q2hlY2sgSW50ZWdyaXR5IQ==\n"
+        "application/octet-stream\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "x-ms-date:Thu, 18 Feb 2021 08:00:00 GMT\n"
+        "x-ms-lease-id:lease\n"
+        "x-ms-meta-name:value\n"
+        "x-ms-version:2020-02-10\n"
+        "/account/container/blob\n"
+        "blockid:MDAw+MDAx==\n"
+        "comp:block");
+  }
+
+  TEST(SharedKeyPolicyTest, StringToSignListBlobs)
+  {
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Get,
+        Core::Http::Url("https://account.blob.core.windows.net/"
+                        "container?restype=container&comp=list&prefix=a%20b&marker=2%211%21MDAw&"
+                        "maxresults=10&include=metadata%2Csnapshots"));
+    request.AddHeader("If-Match", "\"0x8D8D3E1A1B2C3D4\"");
+    request.AddHeader("If-None-Match", "*");
+    request.AddHeader("If-Modified-Since", "Wed, 17 Feb 2021 08:00:00 GMT");
+    request.AddHeader("If-Unmodified-Since", "Fri, 19 Feb 2021 08:00:00 GMT");
+    request.AddHeader("Content-Length", "0");
+    request.AddHeader("Date", "Thu, 18 Feb 2021 08:00:00 GMT");
+    request.AddHeader("x-ms-version", "2020-02-10");
+    EXPECT_EQ(
+        GetStringToSign(request),
+        "GET\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "Thu, 18 Feb 2021 08:00:00 GMT\n"
+        "Wed, 17 Feb 2021 08:00:00 GMT\n"
+        "\"0x8D8D3E1A1B2C3D4\"\n"
+        "*\n"
+        "Fri, 19 Feb 2021 08:00:00 GMT\n"
+        "\n"
+        "x-ms-version:2020-02-10\n"
+        "/account/container\n"
+        "comp:list\n"
+        "include:metadata,snapshots\n"
+        "marker:2!1!MDAw\n"
+        "maxresults:10\n"
+        "prefix:a b\n"
+        "restype:container");
+  }
+
+  TEST(SharedKeyPolicyTest, StringToSignGetPathStatus)
+  {
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Head,
+        Core::Http::Url("https://account.dfs.core.windows.net/fs/a%20b/"
+                        "c?Action=getStatus&upn=true&timeout=30&x=a+b"));
+    request.AddHeader("Range", "bytes=0-");
+    request.AddHeader("Content-Encoding", "gzip");
+    request.AddHeader("Content-Language", "en-US");
+    request.AddHeader("x-ms-version", "2020-02-10");
+    EXPECT_EQ(
+        GetStringToSign(request),
+        "HEAD\n"
+        "gzip\n"
+        "en-US\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "bytes=0-\n"
+        "x-ms-version:2020-02-10\n"
+        "/account/fs/a%20b/c\n"
+        "action:getStatus\n"
+        "timeout:30\n"
+        "upn:true\n"
+        "x:a b");
+  }
+
+  TEST(SharedKeyPolicyTest, StringToSignQueryKeysNotInCanonicalOrder)
+  {
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Get,
+        Core::Http::Url("https://account.blob.core.windows.net/"
+                        "?Zeta=1&alpha=%41&comp=properties&restype=service"));
+    request.AddHeader("x-ms-version", "2020-02-10");
+    EXPECT_EQ(
+        GetStringToSign(request),
+        "GET\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "x-ms-version:2020-02-10\n"
+        "/account/\n"
+        "alpha:A\n"
+        "comp:properties\n"
+        "restype:service\n"
+        "zeta:1");
+  }
+
+  TEST(SharedKeyPolicyTest, StringToSignNoHeaders)
+  {
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Delete,
+        Core::Http::Url("https://127.0.0.1:10000/devstoreaccount1/container/blob"));
+    EXPECT_EQ(
+        GetStringToSign(request, "devstoreaccount1"),
+        "DELETE\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "/devstoreaccount1/devstoreaccount1/container/blob");
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <azure/storage/common/storage_pager.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    struct FakePage
+    {
+      int Index = 0;
+      Azure::Core::Nullable<std::string> ContinuationToken;
+    };
+
+    // pages are numbered from 0, the token of a page is the index of the next one
+    Pager<FakePage>::PageFetcher PageFetcher(
+        int numPages,
+        std::atomic<int>& numFetches,
+        int failingPage = -1)
+    {
+      return [numPages, &numFetches, failingPage](
+                 const Azure::Core::Nullable<std::string>& continuationToken,
+                 const Azure::Core::Context& context) {
+        context.ThrowIfCancelled();
+        ++numFetches;
+        FakePage page;
+        page.Index = continuationToken.HasValue() ? std::stoi(continuationToken.GetValue()) : 0;
+        if (page.Index == failingPage)
+        {
+          throw std::runtime_error("page " + std::to_string(page.Index));
+        }
+        if (page.Index + 1 < numPages)
+        {
+          page.ContinuationToken = std::to_string(page.Index + 1);
+        }
+        return Azure::Core::Response<FakePage>(
+            std::move(page),
+            std::make_unique<Azure::Core::Http::RawResponse>(
+                1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK"));
+      };
+    }
+
+    void WaitFor(const std::atomic<int>& value, int expected)
+    {
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+      while (value < expected && std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  } // namespace
+
+  TEST(StoragePagerTest, AllPagesInOrder)
+  {
+    for (int prefetchPages : {0, 1, 3, 100})
+    {
+      std::atomic<int> numFetches{0};
+      PagerOptions options;
+      options.PrefetchPages = prefetchPages;
+      Pager<FakePage> pager(
+          PageFetcher(10, numFetches),
+          Azure::Core::Nullable<std::string>(),
+          options,
+          Azure::Core::Context());
+      std::vector<int> indices;
+      while (pager.NextPage())
+      {
+        indices.push_back(pager.CurrentPage()->Index);
+      }
+      EXPECT_EQ(indices, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9})) << prefetchPages;
+      EXPECT_EQ(numFetches, 10);
+      EXPECT_FALSE(pager.NextPage());
+    }
+  }
+
+  TEST(StoragePagerTest, StartsAtContinuationToken)
+  {
+    std::atomic<int> numFetches{0};
+    Pager<FakePage> pager(
+        PageFetcher(5, numFetches),
+        std::string("3"),
+        PagerOptions(),
+        Azure::Core::Context());
+    ASSERT_TRUE(pager.NextPage());
+    EXPECT_EQ(pager.CurrentPage()->Index, 3);
+    ASSERT_TRUE(pager.NextPage());
+    EXPECT_EQ(pager.CurrentPage()->Index, 4);
+    EXPECT_FALSE(pager.NextPage());
+  }
+
+  TEST(StoragePagerTest, Prefetch)
+  {
+    std::atomic<int> numFetches{0};
+    PagerOptions options;
+    options.PrefetchPages = 2;
+    Pager<FakePage> pager(
+        PageFetcher(10, numFetches),
+        Azure::Core::Nullable<std::string>(),
+        options,
+        Azure::Core::Context());
+
+    // nothing is fetched before the first page is asked for
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(numFetches, 0);
+
+    ASSERT_TRUE(pager.NextPage());
+    EXPECT_EQ(pager.CurrentPage()->Index, 0);
+    WaitFor(numFetches, 3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    // the current page and two ahead of it
+    EXPECT_EQ(numFetches, 3);
+
+    ASSERT_TRUE(pager.NextPage());
+    EXPECT_EQ(pager.CurrentPage()->Index, 1);
+    WaitFor(numFetches, 4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(numFetches, 4);
+  }
+
+  TEST(StoragePagerTest, Error)
+  {
+    for (int prefetchPages : {0, 1, 3})
+    {
+      std::atomic<int> numFetches{0};
+      PagerOptions options;
+      options.PrefetchPages = prefetchPages;
+      Pager<FakePage> pager(
+          PageFetcher(10, numFetches, 2),
+          Azure::Core::Nullable<std::string>(),
+          options,
+          Azure::Core::Context());
+      ASSERT_TRUE(pager.NextPage());
+      ASSERT_TRUE(pager.NextPage());
+      EXPECT_EQ(pager.CurrentPage()->Index, 1);
+      EXPECT_THROW(pager.NextPage(), std::runtime_error);
+      EXPECT_FALSE(pager.NextPage());
+      EXPECT_EQ(numFetches, 3);
+    }
+  }
+
+  TEST(StoragePagerTest, DestroyedWhilePrefetching)
+  {
+    std::atomic<int> numFetches{0};
+    std::atomic<bool> cancelled{false};
+    {
+      PagerOptions options;
+      options.PrefetchPages = 1;
+      Pager<FakePage> pager(
+          [&](const Azure::Core::Nullable<std::string>& continuationToken,
+              const Azure::Core::Context& context) {
+            ++numFetches;
+            if (continuationToken.HasValue())
+            {
+              // the second page never arrives on its own
+              while (!context.IsCancelled())
+              {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              }
+              cancelled = true;
+              context.ThrowIfCancelled();
+            }
+            FakePage page;
+            page.ContinuationToken = std::string("1");
+            return Azure::Core::Response<FakePage>(
+                std::move(page),
+                std::make_unique<Azure::Core::Http::RawResponse>(
+                    1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK"));
+          },
+          Azure::Core::Nullable<std::string>(),
+          options,
+          Azure::Core::Context());
+      ASSERT_TRUE(pager.NextPage());
+      WaitFor(numFetches, 2);
+    }
+    EXPECT_EQ(numFetches, 2);
+    EXPECT_TRUE(cancelled);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/storage/common/storage_exception.hpp>
+#include <azure/storage/common/storage_result.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    struct FakeResult
+    {
+      int Value = 0;
+    };
+
+    std::unique_ptr<Azure::Core::Http::RawResponse> MakeResponse(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        const std::string& body = std::string())
+    {
+      auto response = std::make_unique<Azure::Core::Http::RawResponse>(1, 1, statusCode, "");
+      response->AddHeader("x-ms-request-id", "request-id");
+      if (!body.empty())
+      {
+        response->AddHeader("content-type", "application/xml");
+        response->SetBody(std::vector<uint8_t>(body.begin(), body.end()));
+      }
+      return response;
+    }
+  } // namespace
+
+  TEST(StorageResultTest, Success)
+  {
+    FakeResult value;
+    value.Value = 42;
+    StorageResult<FakeResult> result(Azure::Core::Response<FakeResult>(
+        std::move(value), MakeResponse(Azure::Core::Http::HttpStatusCode::Ok)));
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result.HasValue());
+    EXPECT_EQ(result->Value, 42);
+    EXPECT_EQ((*result).Value, 42);
+    EXPECT_EQ(result.GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+    EXPECT_EQ(result.GetRequestId(), "request-id");
+    EXPECT_TRUE(result.GetErrorCode().empty());
+
+    auto response = result.ExtractResponse();
+    EXPECT_EQ(response->Value, 42);
+  }
+
+  TEST(StorageResultTest, ErrorCodeFromHeader)
+  {
+    auto rawResponse = MakeResponse(
+        Azure::Core::Http::HttpStatusCode::NotFound,
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?><Error><Code>FromBody</Code>"
+        "<Message>The specified blob does not exist.</Message></Error>");
+    rawResponse->AddHeader("x-ms-error-code", "BlobNotFound");
+    StorageResult<FakeResult> result(Azure::Core::Response<FakeResult>(std::move(rawResponse)));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.GetStatusCode(), Azure::Core::Http::HttpStatusCode::NotFound);
+    EXPECT_EQ(result.GetRequestId(), "request-id");
+    EXPECT_EQ(result.GetErrorCode(), "BlobNotFound");
+    // the body is left alone until the error is asked for
+    EXPECT_FALSE(result.GetRawResponse().GetBody().empty());
+
+    auto& error = result.GetError();
+    EXPECT_EQ(error.ErrorCode, "FromBody");
+    EXPECT_EQ(error.Message, "The specified blob does not exist.");
+    EXPECT_EQ(error.StatusCode, Azure::Core::Http::HttpStatusCode::NotFound);
+    EXPECT_EQ(error.RequestId, "request-id");
+    EXPECT_EQ(result.GetStatusCode(), Azure::Core::Http::HttpStatusCode::NotFound);
+    EXPECT_EQ(result.GetErrorCode(), "BlobNotFound");
+  }
+
+  TEST(StorageResultTest, ErrorCodeFromBody)
+  {
+    StorageResult<FakeResult> result(Azure::Core::Response<FakeResult>(MakeResponse(
+        Azure::Core::Http::HttpStatusCode::Conflict,
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?><Error><Code>ContainerAlreadyExists</Code>"
+        "<Message>The specified container already exists.</Message></Error>")));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.GetErrorCode(), "ContainerAlreadyExists");
+    EXPECT_EQ(result.GetStatusCode(), Azure::Core::Http::HttpStatusCode::Conflict);
+
+    auto rawResponse = result.ExtractRawResponse();
+    ASSERT_TRUE(rawResponse);
+    EXPECT_EQ(rawResponse->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Conflict);
+  }
+
+  TEST(StorageResultTest, ExtractResponseThrows)
+  {
+    auto rawResponse = MakeResponse(Azure::Core::Http::HttpStatusCode::NotFound);
+    rawResponse->AddHeader("x-ms-error-code", "ContainerNotFound");
+    StorageResult<FakeResult> result(Azure::Core::Response<FakeResult>(std::move(rawResponse)));
+    try
+    {
+      result.ExtractResponse();
+      FAIL() << "ExtractResponse didn't throw";
+    }
+    catch (StorageException& e)
+    {
+      EXPECT_EQ(e.StatusCode, Azure::Core::Http::HttpStatusCode::NotFound);
+      EXPECT_EQ(e.RequestId, "request-id");
+      ASSERT_TRUE(e.RawResponse);
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -3,15 +3,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <azure/core/base64.hpp>
 #include <azure/core/datetime.hpp>
 #include <azure/core/etag.hpp>
 #include <azure/core/http/body_stream.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/core/http/transport.hpp>
 #include <azure/storage/common/constants.hpp>
 #include <azure/storage/common/storage_common.hpp>
 #include <gtest/gtest.h>
@@ -90,4 +97,73 @@ namespace Azure { namespace Storage { namespace Test {
     return Azure::Core::Base64Encode(std::vector<uint8_t>(text.begin(), text.end()));
   }
 
+  /**
+   * @brief Answers every request with the same status, headers and body, for tests that don't
+   * talk to the service. Derived fakes can override Send and build their responses with
+   * #MakeResponse.
+   */
+  class CannedResponseTransport : public Azure::Core::Http::HttpTransport {
+  public:
+    explicit CannedResponseTransport(
+        std::string body = std::string(),
+        Azure::Core::Http::HttpStatusCode statusCode = Azure::Core::Http::HttpStatusCode::Ok)
+        : m_statusCode(statusCode), m_body(body.begin(), body.end())
+    {
+    }
+
+    /**
+     * @brief Creates a transport failing every request with the given status and storage error
+     * code, and no error body.
+     */
+    static std::shared_ptr<CannedResponseTransport> CreateError(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        std::string errorCode)
+    {
+      auto transport = std::make_shared<CannedResponseTransport>(std::string(), statusCode);
+      transport->Headers.emplace("x-ms-error-code", std::move(errorCode));
+      return transport;
+    }
+
+    std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+        Azure::Core::Context const&,
+        Azure::Core::Http::Request&) override
+    {
+      ++NumRequests;
+      return MakeResponse(m_statusCode, m_body);
+    }
+
+    /**
+     * @brief Headers added to every response, besides x-ms-request-id.
+     */
+    std::map<std::string, std::string> Headers;
+
+    std::atomic<int> NumRequests{0};
+
+  protected:
+    /**
+     * @brief Creates a response with the given status and body, x-ms-request-id set to
+     * "request-id" and #Headers added.
+     */
+    std::unique_ptr<Azure::Core::Http::RawResponse> MakeResponse(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        std::vector<uint8_t> body) const
+    {
+      auto response = std::make_unique<Azure::Core::Http::RawResponse>(1, 1, statusCode, "");
+      response->AddHeader("x-ms-request-id", "request-id");
+      for (const auto& header : Headers)
+      {
+        response->AddHeader(header.first, header.second);
+      }
+      // the stream reads from the body the response owns
+      response->SetBody(std::move(body));
+      response->SetBodyStream(std::make_unique<Azure::Core::Http::MemoryBodyStream>(
+          response->GetBody().data(), response->GetBody().size()));
+      return response;
+    }
+
+  private:
+    const Azure::Core::Http::HttpStatusCode m_statusCode;
+    const std::vector<uint8_t> m_body;
+  };
+
 }}} // namespace Azure::Storage::Test
@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstring>
+
+#include <azure/storage/common/xml_wrapper.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    struct Node
+    {
+      Details::XmlNodeType Type;
+      std::string Name;
+      std::string Value;
+    };
+
+    bool operator==(const Node& lhs, const Node& rhs)
+    {
+      return lhs.Type == rhs.Type && lhs.Name == rhs.Name && lhs.Value == rhs.Value;
+    }
+
+    // hands out at most a few bytes on every read, like a slow connection
+    class TrickleBodyStream : public Azure::Core::Http::BodyStream {
+    public:
+      explicit TrickleBodyStream(const std::string& data, std::size_t step)
+          : m_data(data), m_step(step)
+      {
+      }
+
+      int64_t Length() const override { return static_cast<int64_t>(m_data.length()); }
+
+    private:
+      int64_t OnRead(const Azure::Core::Context&, uint8_t* buffer, int64_t count) override
+      {
+        std::size_t length = std::min(
+            {static_cast<std::size_t>(count), m_step, m_data.length() - m_offset});
+        std::memcpy(buffer, m_data.data() + m_offset, length);
+        m_offset += length;
+        return static_cast<int64_t>(length);
+      }
+
+      const std::string& m_data;
+      std::size_t m_step;
+      std::size_t m_offset = 0;
+    };
+
+    std::vector<Node> ReadAll(Details::XmlReader& reader)
+    {
+      std::vector<Node> nodes;
+      while (true)
+      {
+        auto node = reader.Read();
+        nodes.push_back(
+            {node.Type, node.Name ? node.Name : std::string(), node.Value ? node.Value : ""});
+        if (node.Type == Details::XmlNodeType::End)
+        {
+          break;
+        }
+      }
+      return nodes;
+    }
+
+    std::vector<Node> ReadAll(const std::string& xml)
+    {
+      Details::XmlReader reader(xml.data(), xml.length());
+      return ReadAll(reader);
+    }
+
+    std::vector<Node> ReadAll(const std::string& xml, std::size_t step)
+    {
+      TrickleBodyStream stream(xml, step);
+      Details::XmlReader reader(stream, Azure::Core::Context());
+      return ReadAll(reader);
+    }
+  } // namespace
+
+  TEST(XmlReaderTest, Nodes)
+  {
+    using Details::XmlNodeType;
+    const std::string xml
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+          "<EnumerationResults ServiceEndpoint=\"https://a/\" ContainerName='c'>\n"
+          "  <Prefix />\n"
+          "  <Blobs>\n"
+          "    <!-- a comment -->\n"
+          "    <Blob><Name Encoded=\"true\">%EF%BF%BF</Name><Empty></Empty></Blob>\n"
+          "  </Blobs>\n"
+          "</EnumerationResults>\n";
+    std::vector<Node> expected{
+        {XmlNodeType::StartTag, "EnumerationResults", ""},
+        {XmlNodeType::Attribute, "ServiceEndpoint", "https://a/"},
+        {XmlNodeType::Attribute, "ContainerName", "c"},
+        {XmlNodeType::SelfClosingTag, "Prefix", ""},
+        {XmlNodeType::StartTag, "Blobs", ""},
+        {XmlNodeType::StartTag, "Blob", ""},
+        {XmlNodeType::StartTag, "Name", ""},
+        {XmlNodeType::Attribute, "Encoded", "true"},
+        {XmlNodeType::Text, "", "%EF%BF%BF"},
+        {XmlNodeType::EndTag, "Name", ""},
+        {XmlNodeType::StartTag, "Empty", ""},
+        {XmlNodeType::EndTag, "Empty", ""},
+        {XmlNodeType::EndTag, "Blob", ""},
+        {XmlNodeType::EndTag, "Blobs", ""},
+        {XmlNodeType::EndTag, "EnumerationResults", ""},
+        {XmlNodeType::End, "", ""},
+    };
+    EXPECT_EQ(ReadAll(xml), expected);
+  }
+
+  TEST(XmlReaderTest, Text)
+  {
+    using Details::XmlNodeType;
+    auto text = [](const std::string& xml) {
+      auto nodes = ReadAll(xml);
+      EXPECT_EQ(nodes.size(), static_cast<std::size_t>(4));
+      EXPECT_EQ(nodes[1].Type, XmlNodeType::Text);
+      return nodes[1].Value;
+    };
+    EXPECT_EQ(text("<a>a&amp;b &lt;c&gt; &quot;&apos;</a>"), "a&b <c> \"'");
+    EXPECT_EQ(text("<a>&#x4E2D;&#25991;&#x1F600;</a>"), "\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80");
+    EXPECT_EQ(text("<a>x\r\ny\rz</a>"), "x\ny\nz");
+    EXPECT_EQ(text("<a><![CDATA[x<y&z]]></a>"), "x<y&z");
+    // whitespace is content when an element holds nothing else
+    EXPECT_EQ(text("<a> </a>"), " ");
+    EXPECT_EQ(text("\xEF\xBB\xBF<a>bom</a>"), "bom");
+
+    auto nodes = ReadAll("<a x=\"1&#10;2\t3&lt;\" y='\"'/>");
+    ASSERT_EQ(nodes.size(), static_cast<std::size_t>(4));
+    EXPECT_EQ(nodes[1].Value, "1\n2 3<");
+    EXPECT_EQ(nodes[2].Value, "\"");
+  }
+
+  TEST(XmlReaderTest, Malformed)
+  {
+    for (const std::string xml :
+         {"",
+          "<a>",
+          "<a></b>",
+          "<a></a><b/>",
+          "text<a/>",
+          "<a>&unknown;</a>",
+          "<a>&#0;</a>",
+          "<a>&#xD800;</a>",
+          "<a>&amp</a>",
+          "<a x=1/>",
+          "<a x=\"1/>",
+          "<!DOCTYPE a><a/>",
+          "<a><!-- </a>"})
+    {
+      EXPECT_THROW(ReadAll(xml), std::runtime_error) << xml;
+      EXPECT_THROW(ReadAll(xml, 1), std::runtime_error) << xml;
+    }
+  }
+
+  TEST(XmlReaderTest, Stream)
+  {
+    std::string xml
+        = "\xEF\xBB\xBF<?xml version=\"1.0\"?>\r\n<EnumerationResults Endpoint=\"e\">";
+    for (int i = 0; i < 2000; ++i)
+    {
+      xml += "<Blob Deleted='a&gt;b'><Name>" + std::to_string(i)
+          + "&amp;</Name><!-- > --><Data><![CDATA[<>]]></Data><Empty>  </Empty><Tag/></Blob>\n";
+    }
+    xml += "<Name>" + std::string(20000, 'x') + "</Name></EnumerationResults>";
+
+    auto expected = ReadAll(xml);
+    for (std::size_t step : {1, 2, 3, 7, 4096, 1024 * 1024})
+    {
+      EXPECT_EQ(ReadAll(xml, step), expected) << step;
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/xml_wrapper.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(XmlWriterTest, Document)
+  {
+    using Details::XmlNode;
+    using Details::XmlNodeType;
+    Details::XmlWriter writer;
+    writer.Write(XmlNode{XmlNodeType::StartTag, "A"});
+    writer.Write(XmlNode{XmlNodeType::Attribute, "x", "a\"<&>\n\r\t'"});
+    writer.Write(XmlNode{XmlNodeType::SelfClosingTag, "B"});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "C"});
+    writer.Write(XmlNode{XmlNodeType::Text, nullptr, "a\"<&>\n\r\t']]>"});
+    writer.Write(XmlNode{XmlNodeType::EndTag});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "D"});
+    writer.Write(XmlNode{XmlNodeType::EndTag});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "E", ""});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "F", "f&"});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "G"});
+    writer.Write(XmlNode{XmlNodeType::End});
+    // the same as libxml2's xmlTextWriter produced
+    EXPECT_EQ(
+        writer.GetDocument(),
+        "<?xml version=\"1.0\"?>\n<A x=\"a&quot;&lt;&amp;&gt;&#10;&#13;&#9;'\"><B/>"
+        "<C>a&quot;&lt;&amp;&gt;\n&#13;\t']]&gt;</C><D/><E></E><F>f&amp;</F><G/></A>\n");
+
+    EXPECT_THROW(writer.Write(XmlNode{XmlNodeType::Attribute, "x", "1"}), std::runtime_error);
+  }
+
+  TEST(XmlWriterTest, RoundTrip)
+  {
+    using Details::XmlNode;
+    using Details::XmlNodeType;
+    const std::string text = "x\ty \"'<&>]]> \xE4\xB8\xAD\r\nz";
+    const std::string attribute = " a\tb\nc\r\n'\"<&> ";
+
+    Details::XmlWriter writer;
+    writer.Write(XmlNode{XmlNodeType::StartTag, "BlockList"});
+    writer.Write(XmlNode{XmlNodeType::Attribute, "a", attribute.data()});
+    for (int i = 0; i < 100; ++i)
+    {
+      writer.Write(XmlNode{XmlNodeType::StartTag, "Latest", text.data()});
+    }
+    writer.Write(XmlNode{XmlNodeType::EndTag});
+    writer.Write(XmlNode{XmlNodeType::End});
+    std::string xml = writer.GetDocument();
+
+    Details::XmlReader reader(xml.data(), xml.length());
+    EXPECT_EQ(reader.Read().Type, XmlNodeType::StartTag);
+    auto node = reader.Read();
+    EXPECT_EQ(node.Type, XmlNodeType::Attribute);
+    EXPECT_EQ(std::string(node.Value), attribute);
+    for (int i = 0; i < 100; ++i)
+    {
+      node = reader.Read();
+      EXPECT_EQ(node.Type, XmlNodeType::StartTag);
+      EXPECT_EQ(std::string(node.Name), "Latest");
+      node = reader.Read();
+      EXPECT_EQ(node.Type, XmlNodeType::Text);
+      EXPECT_EQ(std::string(node.Value), text);
+      EXPECT_EQ(reader.Read().Type, XmlNodeType::EndTag);
+    }
+    EXPECT_EQ(reader.Read().Type, XmlNodeType::EndTag);
+    EXPECT_EQ(reader.Read().Type, XmlNodeType::End);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -11,6 +11,7 @@
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/response.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
 
 #include "azure/storage/files/datalake/datalake_options.hpp"
 #include "azure/storage/files/datalake/datalake_path_client.hpp"
@@ -229,6 +230,40 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const ListPathsSinglePageOptions& options = ListPathsSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the paths in this directory a page at a time. The pages after the one
+     * being consumed are fetched in the background.
+     *
+     * @param recursive If "true", all paths are listed; otherwise, only paths at the root of the
+     * directory are listed.
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListPathsSinglePageResult pages.
+     */
+    Pager<Models::ListPathsSinglePageResult> ListPaths(
+        bool recursive,
+        const ListPathsSinglePageOptions& options = ListPathsSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Walks the tree of paths under this directory, listing up to Concurrency directories
+     * at the same time. Unlike a recursive ListPaths, which is a single sequence of pages, each
+     * directory is listed separately. The callback in the options is called one at a time, from
+     * the threads listing the directories, in no particular order.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. The walk stops at the first
+     * failed listing, whose exception is rethrown.
+     * @remark This request is sent to dfs endpoint.
+     */
+    void WalkTree(
+        const WalkDataLakeDirectoryTreeOptions& options = WalkDataLakeDirectoryTreeOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     explicit DataLakeDirectoryClient(
         Azure::Core::Http::Url directoryUrl,
@@ -11,6 +11,7 @@
 #include <azure/core/response.hpp>
 #include <azure/storage/blobs/blob_container_client.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
 
 #include "azure/storage/files/datalake/datalake_options.hpp"
 #include "azure/storage/files/datalake/datalake_responses.hpp"
@@ -183,6 +184,25 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const ListPathsSinglePageOptions& options = ListPathsSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the paths in this file system a page at a time. The pages after the one
+     * being consumed are fetched in the background.
+     *
+     * @param recursive If "true", all paths are listed; otherwise, only paths at the root of the
+     * filesystem are listed.
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListPathsSinglePageResult pages.
+     */
+    Pager<Models::ListPathsSinglePageResult> ListPaths(
+        bool recursive,
+        const ListPathsSinglePageOptions& options = ListPathsSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Gets the permissions for this file system. The permissions indicate whether
      * file system data may be accessed publicly.
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -184,6 +185,43 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     Azure::Core::Nullable<int32_t> PageSizeHint;
   };
 
+  /**
+   * @brief Optional parameters for DirectoryClient::WalkTree.
+   */
+  struct WalkDataLakeDirectoryTreeOptions
+  {
+    /**
+     * @brief Called for each path in the tree. A directory is walked into only if this returns
+     * true, the value returned for a file is ignored.
+     */
+    std::function<bool(const Models::PathItem& item)> OnPathItem;
+
+    /**
+     * @brief The maximum depth of the directories walked into, the directories right under the
+     * one being walked are at depth 1. 0 only lists the directory itself. The whole tree is
+     * walked if null.
+     */
+    Azure::Core::Nullable<int32_t> MaxDepth;
+
+    /**
+     * @brief The maximum number of directories listed at the same time.
+     */
+    int Concurrency = 8;
+
+    /**
+     * @brief Valid only when Hierarchical Namespace is enabled for the account. If true, the user
+     * identity values returned in the owner and group fields are User Principal Names instead of
+     * Azure Active Directory Object IDs.
+     */
+    Azure::Core::Nullable<bool> UserPrincipalName;
+
+    /**
+     * @brief An optional value that specifies the maximum number of items to return in a single
+     * page.
+     */
+    Azure::Core::Nullable<int32_t> PageSizeHint;
+  };
+
   /**
    * @brief Optional parameters for FileSystemClient::GetAccessPolicy.
    */
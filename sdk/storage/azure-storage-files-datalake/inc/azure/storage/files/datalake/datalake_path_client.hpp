@@ -13,6 +13,7 @@
 #include <azure/core/response.hpp>
 #include <azure/storage/blobs/blob_client.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_result.hpp>
 
 #include "azure/storage/files/datalake/datalake_file_system_client.hpp"
 #include "azure/storage/files/datalake/datalake_options.hpp"
@@ -90,6 +91,19 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const CreateDataLakePathOptions& options = CreateDataLakePathOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates a file or directory like Create, but doesn't throw if the service fails the
+     * request.
+     * @param options Optional parameters to create the resource the path points to.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     * @remark This request is sent to dfs endpoint.
+     */
+    StorageResult<Models::CreateDataLakePathResult> TryCreate(
+        Models::PathResourceType type,
+        const CreateDataLakePathOptions& options = CreateDataLakePathOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a file or directory. By default, the destination is not changed if it already
      * exists.
@@ -117,6 +131,18 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const DeleteDataLakePathOptions& options = DeleteDataLakePathOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Deletes the resource the path points to like Delete, but doesn't throw if the
+     * service fails the request.
+     * @param options Optional parameters to delete the reource the path points to.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     * @remark This request is sent to dfs endpoint.
+     */
+    StorageResult<Models::DeleteDataLakePathResult> TryDelete(
+        const DeleteDataLakePathOptions& options = DeleteDataLakePathOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Deletes the resource the path points to if it exists.
      * @param options Optional parameters to delete the reource the path points to.
@@ -194,6 +220,19 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const GetDataLakePathPropertiesOptions& options = GetDataLakePathPropertiesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Gets the properties of the path like GetProperties, but doesn't throw if the service
+     * fails the request, for example because the path doesn't exist.
+     * @param options Optional parameters to get the properties from the resource the path points
+     *                to.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     * @remark This request is sent to blob endpoint.
+     */
+    StorageResult<Models::GetDataLakePathPropertiesResult> TryGetProperties(
+        const GetDataLakePathPropertiesOptions& options = GetDataLakePathPropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Returns all access control list stored for the given path.
      * @param options Optional parameters to get the ACLs from the resource the path points to.
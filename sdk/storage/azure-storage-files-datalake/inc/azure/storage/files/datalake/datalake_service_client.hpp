@@ -11,6 +11,7 @@
 #include <azure/core/response.hpp>
 #include <azure/storage/blobs/blob_service_client.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
 
 #include "azure/storage/files/datalake/datalake_options.hpp"
 #include "azure/storage/files/datalake/datalake_responses.hpp"
@@ -90,6 +91,22 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const ListFileSystemsSinglePageOptions& options = ListFileSystemsSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the file systems in this account a page at a time. The pages after the
+     * one being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListFileSystemsSinglePageResult pages.
+     */
+    Pager<Models::ListFileSystemsSinglePageResult> ListFileSystems(
+        const ListFileSystemsSinglePageOptions& options = ListFileSystemsSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Retrieves a key that can be used to delegate Active Directory authorization to
      * shared access signatures.
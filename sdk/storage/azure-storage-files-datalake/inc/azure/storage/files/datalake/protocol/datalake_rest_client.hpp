@@ -19,6 +19,7 @@
 #include <azure/core/http/http.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/internal/json.hpp>
+#include <azure/core/internal/json_sax.hpp>
 #include <azure/core/nullable.hpp>
 #include <azure/core/response.hpp>
 #include <azure/storage/common/crypt.hpp>
@@ -473,8 +474,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
             const auto& bodyBuffer = response.GetBody();
             FileSystemListPathsResult result = bodyBuffer.empty()
                 ? FileSystemListPathsResult()
-                : FileSystemListPathsResultFromPathList(
-                    PathListFromJson(Azure::Core::Internal::Json::json::parse(bodyBuffer)));
+                : FileSystemListPathsResultFromPathList(PathListFromJson(bodyBuffer));
             result.RequestId = response.GetHeaders().at(Details::HeaderRequestId);
             if (response.GetHeaders().find(Details::HeaderContinuationToken)
                 != response.GetHeaders().end())
@@ -491,34 +491,97 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           }
         }
 
-        static PathItem PathItemFromJson(const Azure::Core::Internal::Json::json& node)
-        {
-          PathItem result;
-          result.Name = node["name"].get<std::string>();
-          if (node.contains("isDirectory"))
+        // fills in the paths while the page is parsed, without a json value for the whole page
+        class PathListSaxHandler : public Azure::Core::Internal::Json::JsonSaxHandler {
+        public:
+          explicit PathListSaxHandler(PathList& result) : m_result(result) {}
+
+        private:
+          PathItem* CurrentItem()
           {
-            result.IsDirectory = (node["isDirectory"].get<std::string>() == "true");
+            const auto& path = GetPath();
+            return path.size() == 2 && path[0] == "paths" && !m_result.Items.empty()
+                ? &m_result.Items.back()
+                : nullptr;
           }
-          result.LastModified = Core::DateTime::Parse(
-              node["lastModified"].get<std::string>(), Core::DateTime::DateFormat::Rfc1123);
-          result.ETag = node["etag"].get<std::string>();
-          if (node.contains("contentLength"))
+
+          void OnStartObject() override
           {
-            result.FileSize = std::stoll(node["contentLength"].get<std::string>());
+            if (IsAt({"paths"}))
+            {
+              m_result.Items.emplace_back();
+            }
           }
-          result.Owner = node["owner"].get<std::string>();
-          result.Group = node["group"].get<std::string>();
-          result.Permissions = node["permissions"].get<std::string>();
-          return result;
-        }
 
-        static PathList PathListFromJson(const Azure::Core::Internal::Json::json& node)
-        {
-          PathList result;
-          for (const auto& element : node["paths"])
+          void OnString(std::string& value) override
           {
-            result.Items.emplace_back(PathItemFromJson(element));
+            PathItem* item = CurrentItem();
+            if (!item)
+            {
+              return;
+            }
+            const std::string& name = GetPath()[1];
+            if (name == "name")
+            {
+              item->Name = std::move(value);
+            }
+            else if (name == "isDirectory")
+            {
+              item->IsDirectory = value == "true";
+            }
+            else if (name == "lastModified")
+            {
+              item->LastModified
+                  = Core::DateTime::Parse(value, Core::DateTime::DateFormat::Rfc1123);
+            }
+            else if (name == "etag")
+            {
+              item->ETag = std::move(value);
+            }
+            else if (name == "contentLength")
+            {
+              item->FileSize = std::stoll(value);
+            }
+            else if (name == "owner")
+            {
+              item->Owner = std::move(value);
+            }
+            else if (name == "group")
+            {
+              item->Group = std::move(value);
+            }
+            else if (name == "permissions")
+            {
+              item->Permissions = std::move(value);
+            }
+          }
+
+          void OnInteger(int64_t value) override
+          {
+            PathItem* item = CurrentItem();
+            if (item && GetPath()[1] == "contentLength")
+            {
+              item->FileSize = value;
+            }
           }
+
+          void OnBoolean(bool value) override
+          {
+            PathItem* item = CurrentItem();
+            if (item && GetPath()[1] == "isDirectory")
+            {
+              item->IsDirectory = value;
+            }
+          }
+
+          PathList& m_result;
+        };
+
+        static PathList PathListFromJson(const std::vector<uint8_t>& body)
+        {
+          PathList result;
+          PathListSaxHandler handler(result);
+          handler.Parse(body);
           return result;
         }
 
@@ -559,6 +622,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           Core::ETag SourceIfNoneMatch;
           Azure::Core::Nullable<Core::DateTime> SourceIfModifiedSince;
           Azure::Core::Nullable<Core::DateTime> SourceIfUnmodifiedSince;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<PathCreateResult> Create(
@@ -689,7 +753,13 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
                 createOptions.SourceIfUnmodifiedSince.GetValue().ToString(
                     Core::DateTime::DateFormat::Rfc1123));
           }
-          return CreateParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!createOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Created)
+          {
+            return Azure::Core::Response<PathCreateResult>(std::move(pHttpResponse));
+          }
+          return CreateParseResult(context, std::move(pHttpResponse));
         }
 
         struct GetPropertiesOptions
@@ -776,6 +846,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           Core::ETag IfNoneMatch;
           Azure::Core::Nullable<Core::DateTime> IfModifiedSince;
           Azure::Core::Nullable<Core::DateTime> IfUnmodifiedSince;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<PathDeleteResult> Delete(
@@ -833,7 +904,13 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
                 deleteOptions.IfUnmodifiedSince.GetValue().ToString(
                     Core::DateTime::DateFormat::Rfc1123));
           }
-          return DeleteParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!deleteOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Ok)
+          {
+            return Azure::Core::Response<PathDeleteResult>(std::move(pHttpResponse));
+          }
+          return DeleteParseResult(context, std::move(pHttpResponse));
         }
 
         struct SetAccessControlOptions
@@ -3,7 +3,11 @@
 
 #include "azure/storage/files/datalake/datalake_directory_client.hpp"
 
+#include <mutex>
+#include <vector>
+
 #include <azure/core/http/policy.hpp>
+#include <azure/storage/common/concurrent_transfer.hpp>
 #include <azure/storage/common/constants.hpp>
 #include <azure/storage/common/crypt.hpp>
 #include <azure/storage/common/shared_key_policy.hpp>
@@ -302,4 +306,65 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     }
   }
 
+  Pager<Models::ListPathsSinglePageResult> DataLakeDirectoryClient::ListPaths(
+      bool recursive,
+      const ListPathsSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListPathsSinglePageResult>(
+        [client = *this, recursive, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListPathsSinglePage(recursive, pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
+  void DataLakeDirectoryClient::WalkTree(
+      const WalkDataLakeDirectoryTreeOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    std::mutex callbackMutex;
+    Storage::Details::ConcurrentTreeWalk(
+        std::string(),
+        options.Concurrency,
+        [this, &options, &callbackMutex](
+            const std::string& path,
+            int depth,
+            std::vector<std::string>& subdirectories,
+            const Azure::Core::Context& walkContext) {
+          const bool walkSubdirectories
+              = !options.MaxDepth.HasValue() || depth < options.MaxDepth.GetValue();
+          ListPathsSinglePageOptions listOptions;
+          listOptions.UserPrincipalName = options.UserPrincipalName;
+          listOptions.PageSizeHint = options.PageSizeHint;
+          auto pager = (path.empty() ? *this : GetSubdirectoryClient(path))
+                           .ListPaths(false, listOptions, PagerOptions(), walkContext);
+          while (pager.NextPage())
+          {
+            const auto& page = pager.CurrentPage();
+            std::lock_guard<std::mutex> guard(callbackMutex);
+            for (const auto& item : page->Items)
+            {
+              if (options.OnPathItem && !options.OnPathItem(item))
+              {
+                continue;
+              }
+              if (item.IsDirectory && walkSubdirectories)
+              {
+                // the names are full paths, the walk keeps them relative to this directory
+                std::string name = item.Name.substr(item.Name.rfind('/') + 1);
+                subdirectories.push_back(path.empty() ? name : path + '/' + name);
+              }
+            }
+          }
+        },
+        context);
+  }
+
 }}}} // namespace Azure::Storage::Files::DataLake
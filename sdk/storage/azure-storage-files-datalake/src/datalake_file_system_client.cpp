@@ -35,6 +35,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       blobOptions.RetryOptions = options.RetryOptions;
       blobOptions.RetryOptions.SecondaryHostForRetryReads
           = Details::GetBlobUrlFromUrl(options.RetryOptions.SecondaryHostForRetryReads);
+      blobOptions.TransportPolicyOptions = options.TransportPolicyOptions;
       return blobOptions;
     }
   } // namespace
@@ -333,6 +334,25 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         m_fileSystemUrl, *m_pipeline, context, protocolLayerOptions);
   }
 
+  Pager<Models::ListPathsSinglePageResult> DataLakeFileSystemClient::ListPaths(
+      bool recursive,
+      const ListPathsSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListPathsSinglePageResult>(
+        [client = *this, recursive, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListPathsSinglePage(recursive, pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
   Azure::Core::Response<Models::GetDataLakeFileSystemAccessPolicyResult>
   DataLakeFileSystemClient::GetAccessPolicy(
       const GetDataLakeFileSystemAccessPolicyOptions& options,
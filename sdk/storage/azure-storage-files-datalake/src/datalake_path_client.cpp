@@ -31,6 +31,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       blobOptions.RetryOptions = options.RetryOptions;
       blobOptions.RetryOptions.SecondaryHostForRetryReads
           = Details::GetBlobUrlFromUrl(options.RetryOptions.SecondaryHostForRetryReads);
+      blobOptions.TransportPolicyOptions = options.TransportPolicyOptions;
       return blobOptions;
     }
 
@@ -264,6 +265,14 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       Models::PathResourceType type,
       const CreateDataLakePathOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryCreate(type, options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::CreateDataLakePathResult> DataLakePathClient::TryCreate(
+      Models::PathResourceType type,
+      const CreateDataLakePathOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::DataLakeRestClient::Path::CreateOptions protocolLayerOptions;
     protocolLayerOptions.Resource = type;
@@ -280,15 +289,22 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     protocolLayerOptions.Properties = Details::SerializeMetadata(options.Metadata);
     protocolLayerOptions.Umask = options.Umask;
     protocolLayerOptions.Permissions = options.Permissions;
+    protocolLayerOptions.ThrowOnError = false;
     auto result = Details::DataLakeRestClient::Path::Create(
         m_pathUrl, *m_pipeline, context, protocolLayerOptions);
+    if (!result.HasValue())
+    {
+      return StorageResult<Models::CreateDataLakePathResult>(
+          Azure::Core::Response<Models::CreateDataLakePathResult>(result.ExtractRawResponse()));
+    }
     Models::CreateDataLakePathResult ret;
     ret.ETag = std::move(result->ETag);
     ret.LastModified = std::move(result->LastModified.GetValue());
     ret.FileSize = std::move(result->ContentLength);
     ret.RequestId = std::move(result->RequestId);
-    return Azure::Core::Response<Models::CreateDataLakePathResult>(
-        std::move(ret), result.ExtractRawResponse());
+    return StorageResult<Models::CreateDataLakePathResult>(
+        Azure::Core::Response<Models::CreateDataLakePathResult>(
+            std::move(ret), result.ExtractRawResponse()));
   }
 
   Azure::Core::Response<Models::CreateDataLakePathResult> DataLakePathClient::CreateIfNotExists(
@@ -296,28 +312,29 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       const CreateDataLakePathOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
-    {
-      auto createOptions = options;
-      createOptions.AccessConditions.IfNoneMatch = Azure::Core::ETag::Any();
-      return Create(type, createOptions, context);
-    }
-    catch (StorageException& e)
+    auto createOptions = options;
+    createOptions.AccessConditions.IfNoneMatch = Azure::Core::ETag::Any();
+    auto result = TryCreate(type, createOptions, context);
+    if (!result && result.GetErrorCode() == Details::DataLakePathAlreadyExists)
     {
-      if (e.ErrorCode == Details::DataLakePathAlreadyExists)
-      {
-        Models::CreateDataLakePathResult ret;
-        ret.Created = false;
-        return Azure::Core::Response<Models::CreateDataLakePathResult>(
-            std::move(ret), std::move(e.RawResponse));
-      }
-      throw;
+      Models::CreateDataLakePathResult ret;
+      ret.Created = false;
+      return Azure::Core::Response<Models::CreateDataLakePathResult>(
+          std::move(ret), result.ExtractRawResponse());
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::DeleteDataLakePathResult> DataLakePathClient::Delete(
       const DeleteDataLakePathOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryDelete(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::DeleteDataLakePathResult> DataLakePathClient::TryDelete(
+      const DeleteDataLakePathOptions& options,
+      const Azure::Core::Context& context) const
   {
     Details::DataLakeRestClient::Path::DeleteOptions protocolLayerOptions;
     protocolLayerOptions.LeaseIdOptional = options.AccessConditions.LeaseId;
@@ -326,40 +343,52 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
     protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
     protocolLayerOptions.RecursiveOptional = options.Recursive;
+    protocolLayerOptions.ThrowOnError = false;
     auto result = Details::DataLakeRestClient::Path::Delete(
         m_pathUrl, *m_pipeline, context, protocolLayerOptions);
+    if (!result.HasValue())
+    {
+      return StorageResult<Models::DeleteDataLakePathResult>(
+          Azure::Core::Response<Models::DeleteDataLakePathResult>(result.ExtractRawResponse()));
+    }
     Models::DeleteDataLakePathResult ret;
     ret.Deleted = true;
     ret.RequestId = std::move(result->RequestId);
-    return Azure::Core::Response<Models::DeleteDataLakePathResult>(
-        std::move(ret), result.ExtractRawResponse());
+    return StorageResult<Models::DeleteDataLakePathResult>(
+        Azure::Core::Response<Models::DeleteDataLakePathResult>(
+            std::move(ret), result.ExtractRawResponse()));
   }
 
   Azure::Core::Response<Models::DeleteDataLakePathResult> DataLakePathClient::DeleteIfExists(
       const DeleteDataLakePathOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
-    {
-      return Delete(options, context);
-    }
-    catch (StorageException& e)
+    auto result = TryDelete(options, context);
+    if (!result)
     {
-      if (e.ErrorCode == Details::DataLakeFilesystemNotFound
-          || e.ErrorCode == Details::DataLakePathNotFound)
+      auto errorCode = result.GetErrorCode();
+      if (errorCode == Details::DataLakeFilesystemNotFound
+          || errorCode == Details::DataLakePathNotFound)
       {
         Models::DeleteDataLakePathResult ret;
         ret.Deleted = false;
         return Azure::Core::Response<Models::DeleteDataLakePathResult>(
-            std::move(ret), std::move(e.RawResponse));
+            std::move(ret), result.ExtractRawResponse());
       }
-      throw;
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::GetDataLakePathPropertiesResult> DataLakePathClient::GetProperties(
       const GetDataLakePathPropertiesOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryGetProperties(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::GetDataLakePathPropertiesResult> DataLakePathClient::TryGetProperties(
+      const GetDataLakePathPropertiesOptions& options,
+      const Azure::Core::Context& context) const
   {
     Blobs::GetBlobPropertiesOptions blobOptions;
     blobOptions.AccessConditions.IfMatch = options.AccessConditions.IfMatch;
@@ -367,7 +396,13 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     blobOptions.AccessConditions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
     blobOptions.AccessConditions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
     blobOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
-    auto result = m_blobClient.GetProperties(blobOptions, context);
+    auto result = m_blobClient.TryGetProperties(blobOptions, context);
+    if (!result)
+    {
+      return StorageResult<Models::GetDataLakePathPropertiesResult>(
+          Azure::Core::Response<Models::GetDataLakePathPropertiesResult>(
+              result.ExtractRawResponse()));
+    }
     Models::GetDataLakePathPropertiesResult ret;
     ret.ETag = std::move(result->ETag);
     ret.LastModified = std::move(result->LastModified);
@@ -409,8 +444,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     ret.VersionId = std::move(result->VersionId);
     ret.IsCurrentVersion = std::move(result->IsCurrentVersion);
     ret.IsDirectory = Details::MetadataIncidatesIsDirectory(ret.Metadata);
-    return Azure::Core::Response<Models::GetDataLakePathPropertiesResult>(
-        std::move(ret), result.ExtractRawResponse());
+    return StorageResult<Models::GetDataLakePathPropertiesResult>(
+        Azure::Core::Response<Models::GetDataLakePathPropertiesResult>(
+            std::move(ret), result.ExtractRawResponse()));
   }
 
   Azure::Core::Response<Models::GetDataLakePathAccessControlListResult>
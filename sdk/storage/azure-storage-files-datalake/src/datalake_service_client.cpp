@@ -32,6 +32,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       blobOptions.RetryOptions = options.RetryOptions;
       blobOptions.RetryOptions.SecondaryHostForRetryReads
           = Details::GetBlobUrlFromUrl(options.RetryOptions.SecondaryHostForRetryReads);
+      blobOptions.TransportPolicyOptions = options.TransportPolicyOptions;
       return blobOptions;
     }
 
@@ -230,4 +231,22 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         std::move(response), result.ExtractRawResponse());
   }
 
+  Pager<Models::ListFileSystemsSinglePageResult> DataLakeServiceClient::ListFileSystems(
+      const ListFileSystemsSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListFileSystemsSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListFileSystemsSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
 }}}} // namespace Azure::Storage::Files::DataLake
@@ -42,7 +42,8 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake { nam
     {
       result.append(
           pair.first + "="
-          + Azure::Core::Base64Encode(std::vector<uint8_t>(pair.second.begin(), pair.second.end()))
+          + Azure::Core::Base64Encode(
+              reinterpret_cast<const uint8_t*>(pair.second.data()), pair.second.length())
           + ",");
     }
     if (!result.empty())
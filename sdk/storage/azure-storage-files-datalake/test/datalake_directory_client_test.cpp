@@ -4,6 +4,7 @@
 #include "datalake_directory_client_test.hpp"
 
 #include <algorithm>
+#include <set>
 #include <thread>
 
 #include <azure/identity/client_secret_credential.hpp>
@@ -595,6 +596,63 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(DataLakeDirectoryClientTest, WalkTree)
+  {
+    const std::string directoryName = RandomString();
+    auto directoryClient = m_fileSystemClient->GetDirectoryClient(directoryName);
+    directoryClient.Create();
+    std::set<std::string> paths;
+    for (int i = 0; i < 3; ++i)
+    {
+      const std::string subdirectoryName = "dir" + std::to_string(i);
+      directoryClient.GetSubdirectoryClient(subdirectoryName).Create();
+      paths.insert(directoryName + "/" + subdirectoryName);
+      directoryClient.GetFileClient("file" + std::to_string(i)).Create();
+      paths.insert(directoryName + "/file" + std::to_string(i));
+      for (int j = 0; j < 2; ++j)
+      {
+        const std::string pathName = subdirectoryName + "/subdir" + std::to_string(j);
+        directoryClient.GetSubdirectoryClient(pathName).Create();
+        paths.insert(directoryName + "/" + pathName);
+        directoryClient.GetFileClient(pathName + "/file").Create();
+        paths.insert(directoryName + "/" + pathName + "/file");
+      }
+    }
+
+    std::set<std::string> walkedPaths;
+    Files::DataLake::WalkDataLakeDirectoryTreeOptions options;
+    options.Concurrency = 4;
+    options.PageSizeHint = 2;
+    options.OnPathItem = [&walkedPaths](const Files::DataLake::Models::PathItem& item) {
+      walkedPaths.insert(item.Name);
+      return true;
+    };
+    directoryClient.WalkTree(options);
+    EXPECT_EQ(walkedPaths, paths);
+
+    {
+      // Only the directory itself.
+      walkedPaths.clear();
+      options.MaxDepth = 0;
+      directoryClient.WalkTree(options);
+      EXPECT_EQ(walkedPaths.size(), 6U);
+      EXPECT_EQ(walkedPaths.count(directoryName + "/dir0/subdir0"), 0U);
+    }
+    {
+      // A directory that isn't walked into.
+      walkedPaths.clear();
+      options.MaxDepth.Reset();
+      options.OnPathItem = [&walkedPaths, &directoryName](
+                               const Files::DataLake::Models::PathItem& item) {
+        walkedPaths.insert(item.Name);
+        return item.Name != directoryName + "/dir1";
+      };
+      directoryClient.WalkTree(options);
+      EXPECT_EQ(walkedPaths.size(), paths.size() - 4);
+      EXPECT_EQ(walkedPaths.count(directoryName + "/dir1/subdir0"), 0U);
+    }
+  }
+
   TEST_F(DataLakeDirectoryClientTest, ConstructorsWorks)
   {
     {
@@ -443,4 +443,47 @@ namespace Azure { namespace Storage { namespace Test {
       EXPECT_EQ(Files::DataLake::Models::PublicAccessType::Path, ret->AccessType);
     }
   }
+
+  TEST(DataLakeListPathsParseTest, Paths)
+  {
+    const std::string body = "{\"paths\":[{\"contentLength\":\"1024\",\"etag\":\"0x8D8D\","
+                             "\"group\":\"g\",\"lastModified\":\"Thu, 18 Feb 2021 08:03:09 GMT\","
+                             "\"name\":\"dir/f\\u00e9\",\"owner\":\"o\",\"permissions\":\"rw-r-----\"},"
+                             "{\"contentLength\":0,\"isDirectory\":\"true\",\"name\":\"dir\","
+                             "\"unknown\":{\"name\":\"x\"},\"lastModified\":\"Thu, 18 Feb 2021 08:00:00 GMT\"}"
+                             "],\"name\":\"not a path\"}";
+    auto transport = std::make_shared<CannedResponseTransport>(body);
+    transport->Headers.emplace("x-ms-continuation", "token");
+    Files::DataLake::DataLakeClientOptions options;
+    options.TransportPolicyOptions.Transport = transport;
+    Files::DataLake::DataLakeFileSystemClient fileSystemClient(
+        "https://a.dfs.core.windows.net/f", options);
+    auto response = fileSystemClient.ListPathsSinglePage(true);
+    EXPECT_EQ(response->RequestId, "request-id");
+    EXPECT_EQ(response->ContinuationToken.GetValue(), "token");
+    ASSERT_EQ(response->Items.size(), static_cast<std::size_t>(2));
+    const auto& file = response->Items[0];
+    EXPECT_EQ(file.Name, "dir/f\xC3\xA9");
+    EXPECT_FALSE(file.IsDirectory);
+    EXPECT_EQ(file.FileSize, 1024);
+    EXPECT_EQ(file.ETag, "0x8D8D");
+    EXPECT_EQ(file.Owner, "o");
+    EXPECT_EQ(file.Group, "g");
+    EXPECT_EQ(file.Permissions, "rw-r-----");
+    EXPECT_EQ(
+        file.LastModified,
+        Core::DateTime::Parse(
+            "Thu, 18 Feb 2021 08:03:09 GMT", Core::DateTime::DateFormat::Rfc1123));
+    const auto& directory = response->Items[1];
+    EXPECT_EQ(directory.Name, "dir");
+    EXPECT_TRUE(directory.IsDirectory);
+    EXPECT_EQ(directory.FileSize, 0);
+
+    options.TransportPolicyOptions.Transport
+        = std::make_shared<CannedResponseTransport>("{\"paths\":[{\"name\":");
+    Files::DataLake::DataLakeFileSystemClient truncatedClient(
+        "https://a.dfs.core.windows.net/f", options);
+    EXPECT_THROW(truncatedClient.ListPathsSinglePage(true), std::exception);
+  }
+
 }}} // namespace Azure::Storage::Test
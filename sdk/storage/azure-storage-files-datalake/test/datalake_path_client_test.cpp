@@ -395,4 +395,89 @@ namespace Azure { namespace Storage { namespace Test {
       EXPECT_NO_THROW(anonymousClient.GetProperties());
     }
   }
+
+  namespace {
+    Files::DataLake::DataLakePathClient CannedPathClient(
+        std::shared_ptr<CannedResponseTransport> transport)
+    {
+      Files::DataLake::DataLakeClientOptions clientOptions;
+      clientOptions.TransportPolicyOptions.Transport = std::move(transport);
+      return Files::DataLake::DataLakePathClient(
+          "https://a.dfs.core.windows.net/f/p", clientOptions);
+    }
+  } // namespace
+
+  TEST(DataLakeTryOperationsTest, ExpectedErrors)
+  {
+    auto existingClient = CannedPathClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Conflict, "PathAlreadyExists"));
+    auto createResult = existingClient.TryCreate(Files::DataLake::Models::PathResourceType::File);
+    ASSERT_FALSE(createResult);
+    EXPECT_EQ(createResult.GetErrorCode(), "PathAlreadyExists");
+    EXPECT_EQ(createResult.GetRequestId(), "request-id");
+    EXPECT_FALSE(
+        existingClient.CreateIfNotExists(Files::DataLake::Models::PathResourceType::File)->Created);
+    EXPECT_THROW(
+        existingClient.Create(Files::DataLake::Models::PathResourceType::File), StorageException);
+
+    for (const char* errorCode : {"PathNotFound", "FilesystemNotFound"})
+    {
+      auto missingClient = CannedPathClient(CannedResponseTransport::CreateError(
+          Azure::Core::Http::HttpStatusCode::NotFound, errorCode));
+      auto deleteResult = missingClient.TryDelete();
+      ASSERT_FALSE(deleteResult);
+      EXPECT_EQ(deleteResult.GetErrorCode(), errorCode);
+      EXPECT_FALSE(missingClient.DeleteIfExists()->Deleted);
+      EXPECT_THROW(missingClient.Delete(), StorageException);
+    }
+
+    auto missingClient = CannedPathClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::NotFound, "BlobNotFound"));
+    auto properties = missingClient.TryGetProperties();
+    ASSERT_FALSE(properties);
+    EXPECT_EQ(properties.GetStatusCode(), Azure::Core::Http::HttpStatusCode::NotFound);
+    EXPECT_THROW(missingClient.GetProperties(), StorageException);
+  }
+
+  TEST(DataLakeTryOperationsTest, Success)
+  {
+    auto createdTransport = std::make_shared<CannedResponseTransport>(
+        std::string(), Azure::Core::Http::HttpStatusCode::Created);
+    createdTransport->Headers.emplace("etag", "\"0x1\"");
+    createdTransport->Headers.emplace("last-modified", "Wed, 01 Jan 2020 00:00:00 GMT");
+    auto createdClient = CannedPathClient(createdTransport);
+    auto createResult = createdClient.TryCreate(Files::DataLake::Models::PathResourceType::File);
+    ASSERT_TRUE(createResult);
+    EXPECT_EQ(createResult->RequestId, "request-id");
+    EXPECT_TRUE(
+        createdClient.CreateIfNotExists(Files::DataLake::Models::PathResourceType::File)->Created);
+
+    auto deletedClient = CannedPathClient(std::make_shared<CannedResponseTransport>());
+    ASSERT_TRUE(deletedClient.TryDelete());
+    EXPECT_TRUE(deletedClient.DeleteIfExists()->Deleted);
+  }
+
+  TEST(DataLakeTryOperationsTest, OtherErrorsStillThrow)
+  {
+    auto forbiddenClient = CannedPathClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Forbidden, "AuthorizationPermissionMismatch"));
+    EXPECT_THROW(
+        forbiddenClient.CreateIfNotExists(Files::DataLake::Models::PathResourceType::File),
+        StorageException);
+    EXPECT_THROW(forbiddenClient.DeleteIfExists(), StorageException);
+    auto deleteResult = forbiddenClient.TryDelete();
+    ASSERT_FALSE(deleteResult);
+    EXPECT_EQ(deleteResult.GetErrorCode(), "AuthorizationPermissionMismatch");
+
+    // only the error codes meaning the path exists or is gone are expected
+    auto leasedClient = CannedPathClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Conflict, "LeaseIdMissing"));
+    EXPECT_THROW(
+        leasedClient.CreateIfNotExists(Files::DataLake::Models::PathResourceType::File),
+        StorageException);
+    auto otherMissingClient = CannedPathClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::NotFound, "ContainerNotFound"));
+    EXPECT_THROW(otherMissingClient.DeleteIfExists(), StorageException);
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -1178,6 +1178,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           Azure::Core::Nullable<ListSharesIncludeType> ListSharesInclude;
           Azure::Core::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = Details::DefaultServiceApiVersion;
+          std::function<void(ShareItem)> OnShareItem;
         };
 
         static Azure::Core::Response<ServiceListSharesSinglePageResult> ListSharesSinglePage(
@@ -1186,7 +1187,11 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             Azure::Core::Context context,
             const ListSharesSinglePageOptions& listSharesSinglePageOptions)
         {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+          // shares handed to a callback are parsed while the response body is being received
+          Azure::Core::Http::Request request(
+              Azure::Core::Http::HttpMethod::Get,
+              url,
+              static_cast<bool>(listSharesSinglePageOptions.OnShareItem));
           request.GetUrl().AppendQueryParameter(Details::QueryComp, "list");
           if (listSharesSinglePageOptions.Prefix.HasValue())
           {
@@ -1225,7 +1230,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           }
           request.AddHeader(
               Details::HeaderVersion, listSharesSinglePageOptions.ApiVersionParameter);
-          return ListSharesSinglePageParseResult(context, pipeline.Send(context, request));
+          return ListSharesSinglePageParseResult(
+              context, pipeline.Send(context, request), listSharesSinglePageOptions.OnShareItem);
         }
 
       private:
@@ -1919,19 +1925,33 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         static Azure::Core::Response<ServiceListSharesSinglePageResult>
         ListSharesSinglePageParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr,
+            const std::function<void(ShareItem)>& onShareItem)
         {
           auto& response = *responsePtr;
           if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
           {
             // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = Storage::Details::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            ServiceListSharesSinglePageResult result = bodyBuffer.empty()
-                ? ServiceListSharesSinglePageResult()
-                : ServiceListSharesSinglePageResultFromListSharesResponse(
-                    ListSharesResponseFromXml(reader));
+            ServiceListSharesSinglePageResult result;
+            if (onShareItem)
+            {
+              auto bodyStream = response.GetBodyStream();
+              if (bodyStream->Length() != 0)
+              {
+                Storage::Details::XmlReader reader(*bodyStream, context);
+                result = ServiceListSharesSinglePageResultFromListSharesResponse(
+                    ListSharesResponseFromXml(reader, onShareItem));
+              }
+            }
+            else
+            {
+              const auto& bodyBuffer = response.GetBody();
+              auto reader = Storage::Details::XmlReader(
+                  reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
+              result = bodyBuffer.empty() ? ServiceListSharesSinglePageResult()
+                                          : ServiceListSharesSinglePageResultFromListSharesResponse(
+                                              ListSharesResponseFromXml(reader, nullptr));
+            }
             result.RequestId = response.GetHeaders().at(Details::HeaderRequestId);
             return Azure::Core::Response<ServiceListSharesSinglePageResult>(
                 std::move(result), std::move(responsePtr));
@@ -2414,7 +2434,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           return result;
         }
 
-        static ListSharesResponse ListSharesResponseFromXml(Storage::Details::XmlReader& reader)
+        static ListSharesResponse ListSharesResponseFromXml(
+            Storage::Details::XmlReader& reader,
+            const std::function<void(ShareItem)>& onShareItem)
         {
           auto result = ListSharesResponse();
           enum class XmlTagName
@@ -2481,7 +2503,14 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
               if (path.size() == 3 && path[0] == XmlTagName::EnumerationResults
                   && path[1] == XmlTagName::Shares && path[2] == XmlTagName::Share)
               {
-                result.Items.emplace_back(ShareItemFromXml(reader));
+                if (onShareItem)
+                {
+                  onShareItem(ShareItemFromXml(reader));
+                }
+                else
+                {
+                  result.Items.emplace_back(ShareItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4043,6 +4072,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           std::string FileAttributes;
           std::string FileCreationTime;
           std::string FileLastWriteTime;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<DirectoryCreateResult> Create(
@@ -4079,7 +4109,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           request.AddHeader(Details::HeaderFileAttributes, createOptions.FileAttributes);
           request.AddHeader(Details::HeaderFileCreatedOn, createOptions.FileCreationTime);
           request.AddHeader(Details::HeaderFileLastWrittenOn, createOptions.FileLastWriteTime);
-          return CreateParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!createOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Created)
+          {
+            return Azure::Core::Response<DirectoryCreateResult>(std::move(pHttpResponse));
+          }
+          return CreateParseResult(context, std::move(pHttpResponse));
         }
 
         struct GetPropertiesOptions
@@ -4087,6 +4123,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           Azure::Core::Nullable<std::string> ShareSnapshot;
           Azure::Core::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = Details::DefaultServiceApiVersion;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<DirectoryGetPropertiesResult> GetProperties(
@@ -4112,13 +4149,20 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
                     std::to_string(getPropertiesOptions.Timeout.GetValue())));
           }
           request.AddHeader(Details::HeaderVersion, getPropertiesOptions.ApiVersionParameter);
-          return GetPropertiesParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!getPropertiesOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Ok)
+          {
+            return Azure::Core::Response<DirectoryGetPropertiesResult>(std::move(pHttpResponse));
+          }
+          return GetPropertiesParseResult(context, std::move(pHttpResponse));
         }
 
         struct DeleteOptions
         {
           Azure::Core::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = Details::DefaultServiceApiVersion;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<DirectoryDeleteResult> Delete(
@@ -4137,7 +4181,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
                     std::to_string(deleteOptions.Timeout.GetValue())));
           }
           request.AddHeader(Details::HeaderVersion, deleteOptions.ApiVersionParameter);
-          return DeleteParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!deleteOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Accepted)
+          {
+            return Azure::Core::Response<DirectoryDeleteResult>(std::move(pHttpResponse));
+          }
+          return DeleteParseResult(context, std::move(pHttpResponse));
         }
 
         struct SetPropertiesOptions
@@ -4227,6 +4277,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           Azure::Core::Nullable<int32_t> MaxResults;
           Azure::Core::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = Details::DefaultServiceApiVersion;
+          std::function<void(DirectoryItem)> OnDirectoryItem;
+          std::function<void(FileItem)> OnFileItem;
         };
 
         static Azure::Core::Response<DirectoryListFilesAndDirectoriesSinglePageResult>
@@ -4237,7 +4289,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const ListFilesAndDirectoriesSinglePageOptions&
                 listFilesAndDirectoriesSinglePageOptions)
         {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+          // entries handed to a callback are parsed while the response body is being received
+          Azure::Core::Http::Request request(
+              Azure::Core::Http::HttpMethod::Get,
+              url,
+              listFilesAndDirectoriesSinglePageOptions.OnDirectoryItem
+                  || listFilesAndDirectoriesSinglePageOptions.OnFileItem);
           request.GetUrl().AppendQueryParameter(Details::QueryRestype, "directory");
           request.GetUrl().AppendQueryParameter(Details::QueryComp, "list");
           if (listFilesAndDirectoriesSinglePageOptions.Prefix.HasValue())
@@ -4278,7 +4335,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           request.AddHeader(
               Details::HeaderVersion, listFilesAndDirectoriesSinglePageOptions.ApiVersionParameter);
           return ListFilesAndDirectoriesSinglePageParseResult(
-              context, pipeline.Send(context, request));
+              context,
+              pipeline.Send(context, request),
+              listFilesAndDirectoriesSinglePageOptions.OnDirectoryItem,
+              listFilesAndDirectoriesSinglePageOptions.OnFileItem);
         }
 
         struct ListHandlesOptions
@@ -4569,19 +4629,37 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         static Azure::Core::Response<DirectoryListFilesAndDirectoriesSinglePageResult>
         ListFilesAndDirectoriesSinglePageParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr,
+            const std::function<void(DirectoryItem)>& onDirectoryItem,
+            const std::function<void(FileItem)>& onFileItem)
         {
           auto& response = *responsePtr;
           if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
           {
             // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = Storage::Details::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            DirectoryListFilesAndDirectoriesSinglePageResult result = bodyBuffer.empty()
-                ? DirectoryListFilesAndDirectoriesSinglePageResult()
-                : DirectoryListFilesAndDirectoriesSinglePageResultFromListFilesAndDirectoriesSinglePageResponse(
-                    ListFilesAndDirectoriesSinglePageResponseFromXml(reader));
+            DirectoryListFilesAndDirectoriesSinglePageResult result;
+            if (onDirectoryItem || onFileItem)
+            {
+              auto bodyStream = response.GetBodyStream();
+              if (bodyStream->Length() != 0)
+              {
+                Storage::Details::XmlReader reader(*bodyStream, context);
+                result
+                    = DirectoryListFilesAndDirectoriesSinglePageResultFromListFilesAndDirectoriesSinglePageResponse(
+                        ListFilesAndDirectoriesSinglePageResponseFromXml(
+                            reader, onDirectoryItem, onFileItem));
+              }
+            }
+            else
+            {
+              const auto& bodyBuffer = response.GetBody();
+              auto reader = Storage::Details::XmlReader(
+                  reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
+              result = bodyBuffer.empty()
+                  ? DirectoryListFilesAndDirectoriesSinglePageResult()
+                  : DirectoryListFilesAndDirectoriesSinglePageResultFromListFilesAndDirectoriesSinglePageResponse(
+                      ListFilesAndDirectoriesSinglePageResponseFromXml(reader, nullptr, nullptr));
+            }
             result.HttpHeaders.ContentType = response.GetHeaders().at(Details::HeaderContentType);
             result.RequestId = response.GetHeaders().at(Details::HeaderRequestId);
             return Azure::Core::Response<DirectoryListFilesAndDirectoriesSinglePageResult>(
@@ -4759,7 +4837,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         }
 
         static FilesAndDirectoriesListSinglePage FilesAndDirectoriesListSinglePageFromXml(
-            Storage::Details::XmlReader& reader)
+            Storage::Details::XmlReader& reader,
+            const std::function<void(DirectoryItem)>& onDirectoryItem,
+            const std::function<void(FileItem)>& onFileItem)
         {
           auto result = FilesAndDirectoriesListSinglePage();
           enum class XmlTagName
@@ -4805,12 +4885,26 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
               }
               if (path.size() == 1 && path[0] == XmlTagName::Directory)
               {
-                result.DirectoryItems.emplace_back(DirectoryItemFromXml(reader));
+                if (onDirectoryItem)
+                {
+                  onDirectoryItem(DirectoryItemFromXml(reader));
+                }
+                else
+                {
+                  result.DirectoryItems.emplace_back(DirectoryItemFromXml(reader));
+                }
                 path.pop_back();
               }
               else if (path.size() == 1 && path[0] == XmlTagName::File)
               {
-                result.FileItems.emplace_back(FileItemFromXml(reader));
+                if (onFileItem)
+                {
+                  onFileItem(FileItemFromXml(reader));
+                }
+                else
+                {
+                  result.FileItems.emplace_back(FileItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4822,7 +4916,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         }
 
         static ListFilesAndDirectoriesSinglePageResponse
-        ListFilesAndDirectoriesSinglePageResponseFromXml(Storage::Details::XmlReader& reader)
+        ListFilesAndDirectoriesSinglePageResponseFromXml(
+            Storage::Details::XmlReader& reader,
+            const std::function<void(DirectoryItem)>& onDirectoryItem,
+            const std::function<void(FileItem)>& onFileItem)
         {
           auto result = ListFilesAndDirectoriesSinglePageResponse();
           enum class XmlTagName
@@ -4885,7 +4982,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
               if (path.size() == 2 && path[0] == XmlTagName::EnumerationResults
                   && path[1] == XmlTagName::Entries)
               {
-                result.SinglePage = FilesAndDirectoriesListSinglePageFromXml(reader);
+                result.SinglePage
+                    = FilesAndDirectoriesListSinglePageFromXml(reader, onDirectoryItem, onFileItem);
                 path.pop_back();
               }
             }
@@ -5354,6 +5452,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           Azure::Core::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = Details::DefaultServiceApiVersion;
           Azure::Core::Nullable<std::string> LeaseIdOptional;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<FileGetPropertiesResult> GetProperties(
@@ -5383,7 +5482,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             request.AddHeader(
                 Details::HeaderLeaseId, getPropertiesOptions.LeaseIdOptional.GetValue());
           }
-          return GetPropertiesParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!getPropertiesOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Ok)
+          {
+            return Azure::Core::Response<FileGetPropertiesResult>(std::move(pHttpResponse));
+          }
+          return GetPropertiesParseResult(context, std::move(pHttpResponse));
         }
 
         struct DeleteOptions
@@ -5391,6 +5496,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           Azure::Core::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = Details::DefaultServiceApiVersion;
           Azure::Core::Nullable<std::string> LeaseIdOptional;
+          bool ThrowOnError = true;
         };
 
         static Azure::Core::Response<FileDeleteResult> Delete(
@@ -5412,7 +5518,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           {
             request.AddHeader(Details::HeaderLeaseId, deleteOptions.LeaseIdOptional.GetValue());
           }
-          return DeleteParseResult(context, pipeline.Send(context, request));
+          auto pHttpResponse = pipeline.Send(context, request);
+          if (!deleteOptions.ThrowOnError
+              && pHttpResponse->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Accepted)
+          {
+            return Azure::Core::Response<FileDeleteResult>(std::move(pHttpResponse));
+          }
+          return DeleteParseResult(context, std::move(pHttpResponse));
         }
 
         struct SetHttpHeadersOptions
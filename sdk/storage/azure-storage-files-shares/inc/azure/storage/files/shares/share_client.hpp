@@ -8,6 +8,7 @@
 
 #include <azure/core/response.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
 
 #include "azure/storage/files/shares/protocol/share_rest_client.hpp"
 #include "azure/storage/files/shares/share_options.hpp"
@@ -242,6 +243,23 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         = ListFilesAndDirectoriesSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the files and directories in the root directory of this share a page at
+     * a time. The pages after the one being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListFilesAndDirectoriesSinglePageResult pages.
+     */
+    Pager<Models::ListFilesAndDirectoriesSinglePageResult> ListFilesAndDirectories(
+        const ListFilesAndDirectoriesSinglePageOptions& options
+        = ListFilesAndDirectoriesSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     Azure::Core::Http::Url m_shareUrl;
     std::shared_ptr<Azure::Core::Internal::Http::HttpPipeline> m_pipeline;
@@ -9,6 +9,8 @@
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/response.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
+#include <azure/storage/common/storage_result.hpp>
 
 #include "azure/storage/files/shares/protocol/share_rest_client.hpp"
 #include "azure/storage/files/shares/share_client.hpp"
@@ -103,6 +105,16 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const CreateShareDirectoryOptions& options = CreateShareDirectoryOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates the directory like Create, but doesn't throw if the service fails the request.
+     * @param options Optional parameters to create this directory.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     */
+    StorageResult<Models::CreateShareDirectoryResult> TryCreate(
+        const CreateShareDirectoryOptions& options = CreateShareDirectoryOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates the directory if it does not exist.
      * @param options Optional parameters to create this directory.
@@ -125,6 +137,16 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const DeleteShareDirectoryOptions& options = DeleteShareDirectoryOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Deletes the directory like Delete, but doesn't throw if the service fails the request.
+     * @param options Optional parameters to delete this directory.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     */
+    StorageResult<Models::DeleteShareDirectoryResult> TryDelete(
+        const DeleteShareDirectoryOptions& options = DeleteShareDirectoryOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Deletes the directory if it exists.
      * @param options Optional parameters to delete this directory.
@@ -149,6 +171,17 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const GetShareDirectoryPropertiesOptions& options = GetShareDirectoryPropertiesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Gets the properties of the directory like GetProperties, but doesn't throw if the
+     * service fails the request.
+     * @param options Optional parameters to get this directory's properties.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     */
+    StorageResult<Models::GetShareDirectoryPropertiesResult> TryGetProperties(
+        const GetShareDirectoryPropertiesOptions& options = GetShareDirectoryPropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Sets the properties of the directory.
      * @param smbProperties The SMB properties to be set to the directory.
@@ -189,6 +222,36 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         = ListFilesAndDirectoriesSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the files and directories in this directory a page at a time. The pages
+     * after the one being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListFilesAndDirectoriesSinglePageResult pages.
+     */
+    Pager<Models::ListFilesAndDirectoriesSinglePageResult> ListFilesAndDirectories(
+        const ListFilesAndDirectoriesSinglePageOptions& options
+        = ListFilesAndDirectoriesSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Walks the tree of files and directories under this directory, listing up to
+     * Concurrency directories at the same time. The callbacks in the options are called one at a
+     * time, from the threads listing the directories, in no particular order.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. The walk stops at the first
+     * failed listing, whose exception is rethrown.
+     */
+    void WalkTree(
+        const WalkShareDirectoryTreeOptions& options = WalkShareDirectoryTreeOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief List open handles on the directory.
      * @param options Optional parameters to list this directory's open handles.
@@ -201,6 +264,23 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         = ListShareDirectoryHandlesSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the open handles of this directory a page at a time. The pages after the
+     * one being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListShareDirectoryHandlesSinglePageResult pages.
+     */
+    Pager<Models::ListShareDirectoryHandlesSinglePageResult> ListHandles(
+        const ListShareDirectoryHandlesSinglePageOptions& options
+        = ListShareDirectoryHandlesSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Closes a handle opened on a directory at the service.
      * @param handleId The ID of the handle to be closed.
@@ -9,6 +9,8 @@
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/response.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
+#include <azure/storage/common/storage_result.hpp>
 
 #include "azure/storage/files/shares/protocol/share_rest_client.hpp"
 #include "azure/storage/files/shares/share_client.hpp"
@@ -98,6 +100,16 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const DeleteShareFileOptions& options = DeleteShareFileOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Deletes the file like Delete, but doesn't throw if the service fails the request.
+     * @param options Optional parameters to delete this file.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     */
+    StorageResult<Models::DeleteShareFileResult> TryDelete(
+        const DeleteShareFileOptions& options = DeleteShareFileOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Deletes the file if it exists.
      * @param options Optional parameters to delete this file.
@@ -230,6 +242,17 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const GetShareFilePropertiesOptions& options = GetShareFilePropertiesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Gets the properties of a file like GetProperties, but doesn't throw if the service
+     * fails the request.
+     * @param options Optional parameters to get the properties of this file.
+     * @param context Context for cancelling long running operations.
+     * @return The result of the operation, or the error of the service.
+     */
+    StorageResult<Models::GetShareFilePropertiesResult> TryGetProperties(
+        const GetShareFilePropertiesOptions& options = GetShareFilePropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Sets the properties of the file, or resize a file specifying NewSize in options.
      * @param httpHeaders The Http headers to be set to the file.
@@ -309,6 +332,23 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         = ListShareFileHandlesSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the open handles of this file a page at a time. The pages after the one
+     * being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListShareFileHandlesSinglePageResult pages.
+     */
+    Pager<Models::ListShareFileHandlesSinglePageResult> ListHandles(
+        const ListShareFileHandlesSinglePageOptions& options
+        = ListShareFileHandlesSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Closes a handle opened on a file at the service.
      * @param handleId The ID of the handle to be closed.
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -72,6 +73,16 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * @brief Include this parameter to specify one or more datasets to include in the response.
      */
     Azure::Core::Nullable<Models::ListSharesIncludeType> ListSharesIncludeFlags;
+
+    /**
+     * @brief If set, each share is passed to this function as soon as it has been parsed instead
+     * of being added to the Items of the result. The response body is then parsed while it's being
+     * received, so only a small part of it is held in memory at a time.
+     *
+     * @remark A connection failure after the response headers have been received isn't retried in
+     * this mode, since shares may already have been handed out.
+     */
+    std::function<void(Models::ShareItem)> OnShareItem;
   };
 
   struct SetServicePropertiesOptions
@@ -266,6 +277,60 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * items.
      */
     Azure::Core::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief If set, each directory is passed to this function as soon as it has been parsed
+     * instead of being added to the DirectoryItems of the result.
+     */
+    std::function<void(Models::DirectoryItem)> OnDirectoryItem;
+
+    /**
+     * @brief If set, each file is passed to this function as soon as it has been parsed instead of
+     * being added to the FileItems of the result.
+     *
+     * @remark When either callback is set, the response body is parsed while it's being received,
+     * so only a small part of it is held in memory at a time. A connection failure after the
+     * response headers have been received isn't retried in this mode, since entries may already
+     * have been handed out.
+     */
+    std::function<void(Models::FileItem)> OnFileItem;
+  };
+
+  /**
+   * @brief Optional parameters for ShareDirectoryClient::WalkTree.
+   */
+  struct WalkShareDirectoryTreeOptions
+  {
+    /**
+     * @brief Called for each directory in the tree, with its path relative to the directory being
+     * walked. The directory is walked into only if this returns true. All directories are walked
+     * into if empty.
+     */
+    std::function<bool(const std::string& path, const Models::DirectoryItem& item)>
+        OnDirectoryItem;
+
+    /**
+     * @brief Called for each file in the tree, with its path relative to the directory being
+     * walked.
+     */
+    std::function<void(const std::string& path, const Models::FileItem& item)> OnFileItem;
+
+    /**
+     * @brief The maximum depth of the directories walked into, the directories right under the
+     * one being walked are at depth 1. 0 only lists the directory itself. The whole tree is
+     * walked if null.
+     */
+    Azure::Core::Nullable<int32_t> MaxDepth;
+
+    /**
+     * @brief The maximum number of directories listed at the same time.
+     */
+    int Concurrency = 8;
+
+    /**
+     * @brief Specifies the maximum number of entries to return in a single page.
+     */
+    Azure::Core::Nullable<int32_t> PageSizeHint;
   };
 
   struct ListShareDirectoryHandlesSinglePageOptions
@@ -9,6 +9,7 @@
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/response.hpp>
 #include <azure/storage/common/storage_credential.hpp>
+#include <azure/storage/common/storage_pager.hpp>
 
 #include "azure/storage/files/shares/protocol/share_rest_client.hpp"
 #include "azure/storage/files/shares/share_options.hpp"
@@ -78,6 +79,22 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const ListSharesSinglePageOptions& options = ListSharesSinglePageOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Iterates over the shares in this account a page at a time. The pages after the one
+     * being consumed are fetched in the background.
+     *
+     * @param options Optional parameters to execute this function. The listing starts at the
+     * ContinuationToken, if set.
+     * @param pagerOptions Optional parameters of the pager.
+     * @param context Context for cancelling long running operations. It applies to all the page
+     * requests.
+     * @return A Pager over ListSharesSinglePageResult pages.
+     */
+    Pager<Models::ListSharesSinglePageResult> ListShares(
+        const ListSharesSinglePageOptions& options = ListSharesSinglePageOptions(),
+        const PagerOptions& pagerOptions = PagerOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Set the service's properties.
      * @param properties The properties of the service that is to be set.
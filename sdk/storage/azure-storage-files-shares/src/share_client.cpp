@@ -299,6 +299,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.Prefix = options.Prefix;
     protocolLayerOptions.ContinuationToken = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
+    protocolLayerOptions.OnDirectoryItem = options.OnDirectoryItem;
+    protocolLayerOptions.OnFileItem = options.OnFileItem;
     auto result = Details::ShareRestClient::Directory::ListFilesAndDirectoriesSinglePage(
         m_shareUrl, *m_pipeline, context, protocolLayerOptions);
     Models::ListFilesAndDirectoriesSinglePageResult ret;
@@ -317,4 +319,22 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         std::move(ret), result.ExtractRawResponse());
   }
 
+  Pager<Models::ListFilesAndDirectoriesSinglePageResult> ShareClient::ListFilesAndDirectories(
+      const ListFilesAndDirectoriesSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListFilesAndDirectoriesSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListFilesAndDirectoriesSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
 }}}} // namespace Azure::Storage::Files::Shares
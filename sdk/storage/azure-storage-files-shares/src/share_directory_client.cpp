@@ -3,8 +3,12 @@
 
 #include "azure/storage/files/shares/share_directory_client.hpp"
 
+#include <mutex>
+#include <vector>
+
 #include <azure/core/credentials.hpp>
 #include <azure/core/http/policy.hpp>
+#include <azure/storage/common/concurrent_transfer.hpp>
 #include <azure/storage/common/constants.hpp>
 #include <azure/storage/common/crypt.hpp>
 #include <azure/storage/common/shared_key_policy.hpp>
@@ -126,6 +130,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   Azure::Core::Response<Models::CreateShareDirectoryResult> ShareDirectoryClient::Create(
       const CreateShareDirectoryOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryCreate(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::CreateShareDirectoryResult> ShareDirectoryClient::TryCreate(
+      const CreateShareDirectoryOptions& options,
+      const Azure::Core::Context& context) const
   {
     auto protocolLayerOptions = Details::ShareRestClient::Directory::CreateOptions();
     protocolLayerOptions.Metadata = options.Metadata;
@@ -166,8 +177,14 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     {
       protocolLayerOptions.FilePermission = std::string(FileInheritPermission);
     }
+    protocolLayerOptions.ThrowOnError = false;
     auto result = Details::ShareRestClient::Directory::Create(
         m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions);
+    if (!result.HasValue())
+    {
+      return StorageResult<Models::CreateShareDirectoryResult>(
+          Azure::Core::Response<Models::CreateShareDirectoryResult>(result.ExtractRawResponse()));
+    }
     Models::CreateShareDirectoryResult ret;
     ret.Created = true;
     ret.ETag = std::move(result->ETag);
@@ -176,8 +193,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     ret.RequestId = std::move(result->RequestId);
     ret.SmbProperties = std::move(result->SmbProperties);
 
-    return Azure::Core::Response<Models::CreateShareDirectoryResult>(
-        std::move(ret), result.ExtractRawResponse());
+    return StorageResult<Models::CreateShareDirectoryResult>(
+        Azure::Core::Response<Models::CreateShareDirectoryResult>(
+            std::move(ret), result.ExtractRawResponse()));
   }
 
   Azure::Core::Response<Models::CreateShareDirectoryResult> ShareDirectoryClient::CreateIfNotExists(
@@ -185,70 +203,85 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const Azure::Core::Context& context) const
 
   {
-    try
-    {
-      return Create(options, context);
-    }
-    catch (StorageException& e)
+    auto result = TryCreate(options, context);
+    if (!result && result.GetErrorCode() == Details::ResourceAlreadyExists)
     {
-      if (e.ErrorCode == Details::ResourceAlreadyExists)
-      {
-        Models::CreateShareDirectoryResult ret;
-        ret.Created = false;
-        ret.RequestId = std::move(e.RequestId);
-        return Azure::Core::Response<Models::CreateShareDirectoryResult>(
-            std::move(ret), std::move(e.RawResponse));
-      }
-      throw;
+      Models::CreateShareDirectoryResult ret;
+      ret.Created = false;
+      ret.RequestId = result.GetRequestId();
+      return Azure::Core::Response<Models::CreateShareDirectoryResult>(
+          std::move(ret), result.ExtractRawResponse());
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::DeleteShareDirectoryResult> ShareDirectoryClient::Delete(
       const DeleteShareDirectoryOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryDelete(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::DeleteShareDirectoryResult> ShareDirectoryClient::TryDelete(
+      const DeleteShareDirectoryOptions& options,
+      const Azure::Core::Context& context) const
   {
     (void)options;
     auto protocolLayerOptions = Details::ShareRestClient::Directory::DeleteOptions();
+    protocolLayerOptions.ThrowOnError = false;
     auto result = Details::ShareRestClient::Directory::Delete(
         m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions);
+    if (!result.HasValue())
+    {
+      return StorageResult<Models::DeleteShareDirectoryResult>(
+          Azure::Core::Response<Models::DeleteShareDirectoryResult>(result.ExtractRawResponse()));
+    }
     Models::DeleteShareDirectoryResult ret;
     ret.Deleted = true;
-    return Azure::Core::Response<Models::DeleteShareDirectoryResult>(
-        std::move(ret), result.ExtractRawResponse());
+    return StorageResult<Models::DeleteShareDirectoryResult>(
+        Azure::Core::Response<Models::DeleteShareDirectoryResult>(
+            std::move(ret), result.ExtractRawResponse()));
   }
 
   Azure::Core::Response<Models::DeleteShareDirectoryResult> ShareDirectoryClient::DeleteIfExists(
       const DeleteShareDirectoryOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
+    auto result = TryDelete(options, context);
+    if (!result)
     {
-      return Delete(options, context);
-    }
-    catch (StorageException& e)
-    {
-      if (e.ErrorCode == Details::ShareNotFound || e.ErrorCode == Details::ParentNotFound
-          || e.ErrorCode == Details::ResourceNotFound)
+      auto errorCode = result.GetErrorCode();
+      if (errorCode == Details::ShareNotFound || errorCode == Details::ParentNotFound
+          || errorCode == Details::ResourceNotFound)
       {
         Models::DeleteShareDirectoryResult ret;
         ret.Deleted = false;
-        ret.RequestId = std::move(e.RequestId);
+        ret.RequestId = result.GetRequestId();
         return Azure::Core::Response<Models::DeleteShareDirectoryResult>(
-            std::move(ret), std::move(e.RawResponse));
+            std::move(ret), result.ExtractRawResponse());
       }
-      throw;
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::GetShareDirectoryPropertiesResult>
   ShareDirectoryClient::GetProperties(
       const GetShareDirectoryPropertiesOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryGetProperties(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::GetShareDirectoryPropertiesResult> ShareDirectoryClient::TryGetProperties(
+      const GetShareDirectoryPropertiesOptions& options,
+      const Azure::Core::Context& context) const
   {
     (void)options;
     auto protocolLayerOptions = Details::ShareRestClient::Directory::GetPropertiesOptions();
-    return Details::ShareRestClient::Directory::GetProperties(
-        m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    return StorageResult<Models::GetShareDirectoryPropertiesResult>(
+        Details::ShareRestClient::Directory::GetProperties(
+            m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions));
   }
 
   Azure::Core::Response<Models::SetShareDirectoryPropertiesResult>
@@ -316,6 +349,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.Prefix = options.Prefix;
     protocolLayerOptions.ContinuationToken = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
+    protocolLayerOptions.OnDirectoryItem = options.OnDirectoryItem;
+    protocolLayerOptions.OnFileItem = options.OnFileItem;
     auto result = Details::ShareRestClient::Directory::ListFilesAndDirectoriesSinglePage(
         m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions);
     Models::ListFilesAndDirectoriesSinglePageResult ret;
@@ -333,6 +368,72 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         std::move(ret), result.ExtractRawResponse());
   }
 
+  Pager<Models::ListFilesAndDirectoriesSinglePageResult>
+  ShareDirectoryClient::ListFilesAndDirectories(
+      const ListFilesAndDirectoriesSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListFilesAndDirectoriesSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListFilesAndDirectoriesSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
+  void ShareDirectoryClient::WalkTree(
+      const WalkShareDirectoryTreeOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    std::mutex callbackMutex;
+    Storage::Details::ConcurrentTreeWalk(
+        std::string(),
+        options.Concurrency,
+        [this, &options, &callbackMutex](
+            const std::string& path,
+            int depth,
+            std::vector<std::string>& subdirectories,
+            const Azure::Core::Context& walkContext) {
+          const bool walkSubdirectories
+              = !options.MaxDepth.HasValue() || depth < options.MaxDepth.GetValue();
+          ListFilesAndDirectoriesSinglePageOptions listOptions;
+          listOptions.PageSizeHint = options.PageSizeHint;
+          auto pager = (path.empty() ? *this : GetSubdirectoryClient(path))
+                           .ListFilesAndDirectories(listOptions, PagerOptions(), walkContext);
+          while (pager.NextPage())
+          {
+            const auto& page = pager.CurrentPage();
+            std::lock_guard<std::mutex> guard(callbackMutex);
+            for (const auto& item : page->DirectoryItems)
+            {
+              std::string itemPath = path.empty() ? item.Name : path + '/' + item.Name;
+              if (options.OnDirectoryItem && !options.OnDirectoryItem(itemPath, item))
+              {
+                continue;
+              }
+              if (walkSubdirectories)
+              {
+                subdirectories.push_back(std::move(itemPath));
+              }
+            }
+            if (options.OnFileItem)
+            {
+              for (const auto& item : page->FileItems)
+              {
+                options.OnFileItem(path.empty() ? item.Name : path + '/' + item.Name, item);
+              }
+            }
+          }
+        },
+        context);
+  }
+
   Azure::Core::Response<Models::ListShareDirectoryHandlesSinglePageResult>
   ShareDirectoryClient::ListHandlesSinglePage(
       const ListShareDirectoryHandlesSinglePageOptions& options,
@@ -352,6 +453,24 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         std::move(ret), result.ExtractRawResponse());
   }
 
+  Pager<Models::ListShareDirectoryHandlesSinglePageResult> ShareDirectoryClient::ListHandles(
+      const ListShareDirectoryHandlesSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListShareDirectoryHandlesSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListHandlesSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
   Azure::Core::Response<Models::ForceCloseShareDirectoryHandleResult>
   ShareDirectoryClient::ForceCloseHandle(
       const std::string& handleId,
@@ -201,39 +201,51 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   Azure::Core::Response<Models::DeleteShareFileResult> ShareFileClient::Delete(
       const DeleteShareFileOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryDelete(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::DeleteShareFileResult> ShareFileClient::TryDelete(
+      const DeleteShareFileOptions& options,
+      const Azure::Core::Context& context) const
   {
     auto protocolLayerOptions = Details::ShareRestClient::File::DeleteOptions();
     protocolLayerOptions.LeaseIdOptional = options.AccessConditions.LeaseId;
+    protocolLayerOptions.ThrowOnError = false;
     auto result = Details::ShareRestClient::File::Delete(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
+    if (!result.HasValue())
+    {
+      return StorageResult<Models::DeleteShareFileResult>(
+          Azure::Core::Response<Models::DeleteShareFileResult>(result.ExtractRawResponse()));
+    }
     Models::DeleteShareFileResult ret;
     ret.Deleted = true;
     ret.RequestId = std::move(result->RequestId);
-    return Azure::Core::Response<Models::DeleteShareFileResult>(
-        std::move(ret), result.ExtractRawResponse());
+    return StorageResult<Models::DeleteShareFileResult>(
+        Azure::Core::Response<Models::DeleteShareFileResult>(
+            std::move(ret), result.ExtractRawResponse()));
   }
 
   Azure::Core::Response<Models::DeleteShareFileResult> ShareFileClient::DeleteIfExists(
       const DeleteShareFileOptions& options,
       const Azure::Core::Context& context) const
   {
-    try
-    {
-      return Delete(options, context);
-    }
-    catch (StorageException& e)
+    auto result = TryDelete(options, context);
+    if (!result)
     {
-      if (e.ErrorCode == Details::ShareNotFound || e.ErrorCode == Details::ParentNotFound
-          || e.ErrorCode == Details::ResourceNotFound)
+      auto errorCode = result.GetErrorCode();
+      if (errorCode == Details::ShareNotFound || errorCode == Details::ParentNotFound
+          || errorCode == Details::ResourceNotFound)
       {
         Models::DeleteShareFileResult ret;
         ret.Deleted = false;
-        ret.RequestId = std::move(e.RequestId);
+        ret.RequestId = result.GetRequestId();
         return Azure::Core::Response<Models::DeleteShareFileResult>(
-            std::move(ret), std::move(e.RawResponse));
+            std::move(ret), result.ExtractRawResponse());
       }
-      throw;
     }
+    return result.ExtractResponse();
   }
 
   Azure::Core::Response<Models::DownloadShareFileResult> ShareFileClient::Download(
@@ -404,11 +416,20 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   Azure::Core::Response<Models::GetShareFilePropertiesResult> ShareFileClient::GetProperties(
       const GetShareFilePropertiesOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return TryGetProperties(options, context).ExtractResponse();
+  }
+
+  StorageResult<Models::GetShareFilePropertiesResult> ShareFileClient::TryGetProperties(
+      const GetShareFilePropertiesOptions& options,
+      const Azure::Core::Context& context) const
   {
     auto protocolLayerOptions = Details::ShareRestClient::File::GetPropertiesOptions();
     protocolLayerOptions.LeaseIdOptional = options.AccessConditions.LeaseId;
-    return Details::ShareRestClient::File::GetProperties(
-        m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
+    protocolLayerOptions.ThrowOnError = false;
+    return StorageResult<Models::GetShareFilePropertiesResult>(
+        Details::ShareRestClient::File::GetProperties(
+            m_shareFileUrl, *m_pipeline, context, protocolLayerOptions));
   }
 
   Azure::Core::Response<Models::SetShareFilePropertiesResult> ShareFileClient::SetProperties(
@@ -589,6 +610,24 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         std::move(ret), result.ExtractRawResponse());
   }
 
+  Pager<Models::ListShareFileHandlesSinglePageResult> ShareFileClient::ListHandles(
+      const ListShareFileHandlesSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListShareFileHandlesSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListHandlesSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
   Azure::Core::Response<Models::ForceCloseShareFileHandleResult> ShareFileClient::ForceCloseHandle(
       const std::string& handleId,
       const ForceCloseShareFileHandleOptions& options,
@@ -716,7 +755,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        context);
     ret->ContentRange.Offset = firstChunkOffset;
     ret->ContentRange.Length = fileRangeSize;
     return ret;
@@ -766,29 +806,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     }
     firstChunkLength = std::min(firstChunkLength, fileRangeSize);
 
-    auto bodyStreamToFile = [](Azure::Core::Http::BodyStream& stream,
-                               Storage::Details::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
-      constexpr std::size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
-      while (length > 0)
-      {
-        int64_t readSize = std::min(static_cast<int64_t>(bufferSize), length);
-        int64_t bytesRead
-            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.data(), readSize);
-        if (bytesRead != readSize)
-        {
-          throw Azure::Core::RequestFailedException("error when reading body stream");
-        }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
-        length -= bytesRead;
-        offset += bytesRead;
-      }
-    };
-
-    bodyStreamToFile(*(firstChunk->BodyStream), fileWriter, 0, firstChunkLength, context);
+    Storage::Details::BodyStreamToFile(
+        *(firstChunk->BodyStream), fileWriter, 0, firstChunkLength, context);
     firstChunk->BodyStream.reset();
 
     auto returnTypeConverter
@@ -810,7 +829,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             chunkOptions.Range.GetValue().Offset = offset;
             chunkOptions.Range.GetValue().Length = length;
             auto chunk = Download(chunkOptions, context);
-            bodyStreamToFile(
+            Storage::Details::BodyStreamToFile(
                 *(chunk->BodyStream),
                 fileWriter,
                 offset - firstChunkOffset,
@@ -831,7 +850,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        context);
     ret->ContentRange.Offset = firstChunkOffset;
     ret->ContentRange.Length = fileRangeSize;
     return ret;
@@ -932,7 +952,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (bufferSize > 0)
     {
       Storage::Details::ConcurrentTransfer(
-          0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          context);
     }
 
     Models::UploadShareFileFromResult result;
@@ -1038,7 +1063,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (fileSize > 0)
     {
       Storage::Details::ConcurrentTransfer(
-          0, fileSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          fileSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          context);
     }
 
     Models::UploadShareFileFromResult result;
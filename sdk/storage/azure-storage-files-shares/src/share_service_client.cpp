@@ -102,10 +102,29 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.ContinuationToken = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.OnShareItem = options.OnShareItem;
     return Details::ShareRestClient::Service::ListSharesSinglePage(
         m_serviceUrl, *m_pipeline, context, protocolLayerOptions);
   }
 
+  Pager<Models::ListSharesSinglePageResult> ShareServiceClient::ListShares(
+      const ListSharesSinglePageOptions& options,
+      const PagerOptions& pagerOptions,
+      const Azure::Core::Context& context) const
+  {
+    return Pager<Models::ListSharesSinglePageResult>(
+        [client = *this, options](
+            const Azure::Core::Nullable<std::string>& continuationToken,
+            const Azure::Core::Context& pageContext) {
+          auto pageOptions = options;
+          pageOptions.ContinuationToken = continuationToken;
+          return client.ListSharesSinglePage(pageOptions, pageContext);
+        },
+        options.ContinuationToken,
+        pagerOptions,
+        context);
+  }
+
   Azure::Core::Response<Models::SetServicePropertiesResult> ShareServiceClient::SetProperties(
       Models::FileServiceProperties properties,
       const SetServicePropertiesOptions& options,
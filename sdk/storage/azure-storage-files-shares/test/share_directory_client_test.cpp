@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <set>
 
 namespace Azure { namespace Storage { namespace Test {
 
@@ -430,6 +431,105 @@ namespace Azure { namespace Storage { namespace Test {
       auto response = directoryNameAClient.ListFilesAndDirectoriesSinglePage(options);
       EXPECT_LE(2U, response->DirectoryItems.size() + response->FileItems.size());
     }
+    {
+      // List with callbacks
+      std::vector<std::string> directoryNames;
+      std::vector<std::string> fileNames;
+      Files::Shares::ListFilesAndDirectoriesSinglePageOptions options;
+      options.OnDirectoryItem = [&directoryNames](Files::Shares::Models::DirectoryItem item) {
+        directoryNames.emplace_back(std::move(item.Name));
+      };
+      options.OnFileItem = [&fileNames](Files::Shares::Models::FileItem item) {
+        EXPECT_EQ(1024, item.Details.ContentLength);
+        fileNames.emplace_back(std::move(item.Name));
+      };
+      auto directoryNameAClient
+          = m_shareClient->GetRootDirectoryClient().GetSubdirectoryClient(directoryNameA);
+      do
+      {
+        auto response = directoryNameAClient.ListFilesAndDirectoriesSinglePage(options);
+        EXPECT_TRUE(response->DirectoryItems.empty());
+        EXPECT_TRUE(response->FileItems.empty());
+        options.ContinuationToken = response->ContinuationToken;
+      } while (options.ContinuationToken.HasValue());
+      std::sort(directoryNames.begin(), directoryNames.end());
+      std::sort(fileNames.begin(), fileNames.end());
+      std::sort(directoryNameSetA.begin(), directoryNameSetA.end());
+      std::sort(fileNameSetA.begin(), fileNameSetA.end());
+      EXPECT_EQ(directoryNames, directoryNameSetA);
+      EXPECT_EQ(fileNames, fileNameSetA);
+    }
+  }
+
+  TEST_F(FileShareDirectoryClientTest, WalkTree)
+  {
+    auto directoryClient
+        = m_shareClient->GetRootDirectoryClient().GetSubdirectoryClient(LowercaseRandomString());
+    directoryClient.Create();
+    std::set<std::string> directoryPaths;
+    std::set<std::string> filePaths;
+    for (int i = 0; i < 3; ++i)
+    {
+      const std::string directoryPath = "dir" + std::to_string(i);
+      directoryClient.GetSubdirectoryClient(directoryPath).Create();
+      directoryPaths.insert(directoryPath);
+      directoryClient.GetFileClient("file" + std::to_string(i)).Create(1024);
+      filePaths.insert("file" + std::to_string(i));
+      for (int j = 0; j < 2; ++j)
+      {
+        const std::string subdirectoryPath = directoryPath + "/subdir" + std::to_string(j);
+        directoryClient.GetSubdirectoryClient(subdirectoryPath).Create();
+        directoryPaths.insert(subdirectoryPath);
+        directoryClient.GetFileClient(subdirectoryPath + "/file").Create(1024);
+        filePaths.insert(subdirectoryPath + "/file");
+      }
+    }
+
+    std::set<std::string> walkedDirectoryPaths;
+    std::set<std::string> walkedFilePaths;
+    Files::Shares::WalkShareDirectoryTreeOptions options;
+    options.Concurrency = 4;
+    options.PageSizeHint = 2;
+    options.OnDirectoryItem = [&walkedDirectoryPaths](
+                                  const std::string& path,
+                                  const Files::Shares::Models::DirectoryItem&) {
+      walkedDirectoryPaths.insert(path);
+      return true;
+    };
+    options.OnFileItem = [&walkedFilePaths](
+                             const std::string& path, const Files::Shares::Models::FileItem& item) {
+      EXPECT_EQ(1024, item.Details.ContentLength);
+      walkedFilePaths.insert(path);
+    };
+    directoryClient.WalkTree(options);
+    EXPECT_EQ(walkedDirectoryPaths, directoryPaths);
+    EXPECT_EQ(walkedFilePaths, filePaths);
+
+    {
+      // Only the directory itself.
+      walkedDirectoryPaths.clear();
+      walkedFilePaths.clear();
+      options.MaxDepth = 0;
+      directoryClient.WalkTree(options);
+      EXPECT_EQ(walkedDirectoryPaths, std::set<std::string>({"dir0", "dir1", "dir2"}));
+      EXPECT_EQ(walkedFilePaths, std::set<std::string>({"file0", "file1", "file2"}));
+    }
+    {
+      // A directory that isn't walked into.
+      walkedDirectoryPaths.clear();
+      walkedFilePaths.clear();
+      options.MaxDepth.Reset();
+      options.OnDirectoryItem = [&walkedDirectoryPaths](
+                                    const std::string& path,
+                                    const Files::Shares::Models::DirectoryItem&) {
+        walkedDirectoryPaths.insert(path);
+        return path != "dir1";
+      };
+      directoryClient.WalkTree(options);
+      EXPECT_EQ(walkedDirectoryPaths.size(), directoryPaths.size() - 2);
+      EXPECT_EQ(walkedFilePaths.size(), filePaths.size() - 2);
+      EXPECT_EQ(walkedFilePaths.count("dir1/subdir0/file"), 0U);
+    }
   }
 
   TEST_F(FileShareDirectoryClientTest, HandlesFunctionalityWorks)
@@ -439,4 +539,69 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_FALSE(result->ContinuationToken.HasValue());
     EXPECT_NO_THROW(m_fileShareDirectoryClient->ForceCloseAllHandlesSinglePage());
   }
+
+  namespace {
+    Files::Shares::ShareDirectoryClient CannedDirectoryClient(
+        std::shared_ptr<CannedResponseTransport> transport)
+    {
+      Files::Shares::ShareClientOptions clientOptions;
+      clientOptions.TransportPolicyOptions.Transport = std::move(transport);
+      return Files::Shares::ShareDirectoryClient(
+          "https://a.file.core.windows.net/s/d", clientOptions);
+    }
+  } // namespace
+
+  TEST(ShareTryOperationsTest, DirectoryExpectedErrors)
+  {
+    auto existingClient = CannedDirectoryClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Conflict, "ResourceAlreadyExists"));
+    auto createResult = existingClient.TryCreate();
+    ASSERT_FALSE(createResult);
+    EXPECT_EQ(createResult.GetErrorCode(), "ResourceAlreadyExists");
+    auto createIfNotExistsResult = existingClient.CreateIfNotExists();
+    EXPECT_FALSE(createIfNotExistsResult->Created);
+    EXPECT_EQ(createIfNotExistsResult->RequestId, "request-id");
+    EXPECT_THROW(existingClient.Create(), StorageException);
+
+    for (const char* errorCode : {"ParentNotFound", "ResourceNotFound", "ShareNotFound"})
+    {
+      auto missingClient = CannedDirectoryClient(CannedResponseTransport::CreateError(
+          Azure::Core::Http::HttpStatusCode::NotFound, errorCode));
+      auto deleteResult = missingClient.TryDelete();
+      ASSERT_FALSE(deleteResult);
+      EXPECT_EQ(deleteResult.GetErrorCode(), errorCode);
+      auto deleteIfExistsResult = missingClient.DeleteIfExists();
+      EXPECT_FALSE(deleteIfExistsResult->Deleted);
+      EXPECT_EQ(deleteIfExistsResult->RequestId, "request-id");
+      EXPECT_THROW(missingClient.Delete(), StorageException);
+
+      auto properties = missingClient.TryGetProperties();
+      ASSERT_FALSE(properties);
+      EXPECT_EQ(properties.GetErrorCode(), errorCode);
+      EXPECT_THROW(missingClient.GetProperties(), StorageException);
+    }
+
+    auto deletedClient = CannedDirectoryClient(std::make_shared<CannedResponseTransport>(
+        std::string(), Azure::Core::Http::HttpStatusCode::Accepted));
+    ASSERT_TRUE(deletedClient.TryDelete());
+    EXPECT_TRUE(deletedClient.DeleteIfExists()->Deleted);
+  }
+
+  TEST(ShareTryOperationsTest, DirectoryOtherErrorsStillThrow)
+  {
+    auto forbiddenClient = CannedDirectoryClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Forbidden, "AuthorizationFailure"));
+    EXPECT_THROW(forbiddenClient.CreateIfNotExists(), StorageException);
+    EXPECT_THROW(forbiddenClient.DeleteIfExists(), StorageException);
+    auto createResult = forbiddenClient.TryCreate();
+    ASSERT_FALSE(createResult);
+    EXPECT_EQ(createResult.GetErrorCode(), "AuthorizationFailure");
+
+    // only the error codes meaning the directory exists or is gone are expected
+    auto notEmptyClient = CannedDirectoryClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Conflict, "DirectoryNotEmpty"));
+    EXPECT_THROW(notEmptyClient.CreateIfNotExists(), StorageException);
+    EXPECT_THROW(notEmptyClient.DeleteIfExists(), StorageException);
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <chrono>
 #include <future>
+#include <random>
 
 #include <azure/core/cryptography/hash.hpp>
 #include <azure/storage/common/crypt.hpp>
@@ -937,4 +938,54 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  namespace {
+    Files::Shares::ShareFileClient CannedFileClient(
+        std::shared_ptr<CannedResponseTransport> transport)
+    {
+      Files::Shares::ShareClientOptions clientOptions;
+      clientOptions.TransportPolicyOptions.Transport = std::move(transport);
+      return Files::Shares::ShareFileClient("https://a.file.core.windows.net/s/d/f", clientOptions);
+    }
+  } // namespace
+
+  TEST(ShareTryOperationsTest, FileExpectedErrors)
+  {
+    for (const char* errorCode : {"ParentNotFound", "ResourceNotFound", "ShareNotFound"})
+    {
+      auto missingClient = CannedFileClient(CannedResponseTransport::CreateError(
+          Azure::Core::Http::HttpStatusCode::NotFound, errorCode));
+      auto deleteResult = missingClient.TryDelete();
+      ASSERT_FALSE(deleteResult);
+      EXPECT_EQ(deleteResult.GetErrorCode(), errorCode);
+      auto deleteIfExistsResult = missingClient.DeleteIfExists();
+      EXPECT_FALSE(deleteIfExistsResult->Deleted);
+      EXPECT_EQ(deleteIfExistsResult->RequestId, "request-id");
+      EXPECT_THROW(missingClient.Delete(), StorageException);
+
+      auto properties = missingClient.TryGetProperties();
+      ASSERT_FALSE(properties);
+      EXPECT_EQ(properties.GetErrorCode(), errorCode);
+      EXPECT_THROW(missingClient.GetProperties(), StorageException);
+    }
+
+    auto deletedClient = CannedFileClient(std::make_shared<CannedResponseTransport>(
+        std::string(), Azure::Core::Http::HttpStatusCode::Accepted));
+    ASSERT_TRUE(deletedClient.TryDelete());
+    EXPECT_TRUE(deletedClient.DeleteIfExists()->Deleted);
+  }
+
+  TEST(ShareTryOperationsTest, FileOtherErrorsStillThrow)
+  {
+    auto forbiddenClient = CannedFileClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Forbidden, "AuthorizationFailure"));
+    EXPECT_THROW(forbiddenClient.DeleteIfExists(), StorageException);
+    auto deleteResult = forbiddenClient.TryDelete();
+    ASSERT_FALSE(deleteResult);
+    EXPECT_EQ(deleteResult.GetErrorCode(), "AuthorizationFailure");
+
+    auto lockedClient = CannedFileClient(CannedResponseTransport::CreateError(
+        Azure::Core::Http::HttpStatusCode::Conflict, "SharingViolation"));
+    EXPECT_THROW(lockedClient.DeleteIfExists(), StorageException);
+  }
+
 }}} // namespace Azure::Storage::Test